@@ -70,6 +70,16 @@ enum class VsyncMode
 	Adaptive,
 };
 
+// Determinism check of the EE/IOP synchronization (see iopSyncPointVsync). Record a
+// reference trace with the default single-threaded IOP, then compare another mode
+// (e.g. THREAD_IOP) against it from a fresh boot of the same content.
+enum IopSyncCheckMode
+{
+	IopSyncCheck_Off = 0,
+	IopSyncCheck_Record,	// writes the per-vsync digests to iopsync.trace
+	IopSyncCheck_Compare,	// reports the first vsync whose digest differs from iopsync.trace
+};
+
 // Template function for casting enumerations to their underlying type
 template <typename Enumeration>
 typename std::underlying_type<Enumeration>::type enum_cast(Enumeration E)
@@ -247,6 +257,8 @@ struct Pcsx2Config
 				PreBlockCheckIOP:1;
 			bool
 				EnableEECache   :1;
+			bool
+				PrecompileVif	:1;		// compile the VIF unpacks seen in previous sessions at reset
 		BITFIELD_END
 
 		RecompilerOptions();
@@ -395,7 +407,8 @@ struct Pcsx2Config
 				IntcStat		:1,		// tells Pcsx2 to fast-forward through intc_stat waits.
 				WaitLoop		:1,		// enables constant loop detection and fast-forwarding
 				vuFlagHack		:1,		// microVU specific flag hack
-				vuThread        :1;		// Enable Threaded VU1
+				vuThread        :1,		// Enable Threaded VU1
+				iopThread       :1;		// Run the IOP timeslices on their own host thread (see IopThread.h)
 		BITFIELD_END
 
 		s8	EECycleRate;		// EE cycle rate selector (1.0, 1.5, 2.0)
@@ -423,6 +436,8 @@ struct Pcsx2Config
 				ShowDebuggerOnStart	:1;
 			bool
 				AlignMemoryWindowStart :1;
+			bool
+				PageProtectWatchpoints :1;	// EE ram write memchecks by page protection instead of instrumented stores (approximate)
 		BITFIELD_END
 
 		u8 FontWidth;
@@ -430,6 +445,7 @@ struct Pcsx2Config
 		u32 WindowWidth;
 		u32 WindowHeight;
 		u32 MemoryViewBytesPerRow;
+		u8 IopSyncCheck;		// IopSyncCheckMode, records or compares the per-vsync IOP sync digests
 
 		DebugOptions();
 		void LoadSave( IniInterface& conf );
@@ -437,7 +453,8 @@ struct Pcsx2Config
 		bool operator ==( const DebugOptions& right ) const
 		{
 			return OpEqu( bitset ) && OpEqu( FontWidth ) && OpEqu( FontHeight )
-				&& OpEqu( WindowWidth ) && OpEqu( WindowHeight ) && OpEqu( MemoryViewBytesPerRow );
+				&& OpEqu( WindowWidth ) && OpEqu( WindowHeight ) && OpEqu( MemoryViewBytesPerRow )
+				&& OpEqu( IopSyncCheck );
 		}
 
 		bool operator !=( const DebugOptions& right ) const
@@ -526,6 +543,7 @@ TraceLogFilters&				SetTraceConfig();
 // ------------ CPU / Recompiler Options ---------------
 
 #define THREAD_VU1					(EmuConfig.Cpu.Recompiler.UseMicroVU1 && EmuConfig.Speedhacks.vuThread)
+#define THREAD_IOP					(EmuConfig.Speedhacks.iopThread)
 #define CHECK_MICROVU0				(EmuConfig.Cpu.Recompiler.UseMicroVU0)
 #define CHECK_MICROVU1				(EmuConfig.Cpu.Recompiler.UseMicroVU1)
 #define CHECK_EEREC					(EmuConfig.Cpu.Recompiler.EnableEE && GetCpuProviders().IsRecAvailable_EE())
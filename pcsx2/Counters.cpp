@@ -27,6 +27,7 @@
 
 #include "GS.h"
 #include "VUmicro.h"
+#include "MTVU.h"
 
 #include "ps2/HwInternal.h"
 
@@ -450,9 +451,11 @@ static __fi void VSyncStart(u32 sCycle)
 	// FIXME: should probably be moved to VsyncInThread, and handled
 	// by UI implementations.  (ie, AppCoreThread in PCSX2-wx interface).
 	vSyncDebugStuff( g_FrameCount );
+	iopSyncPointVsync();
 
 	CpuVU0->Vsync();
 	CpuVU1->Vsync();
+	if (THREAD_VU1) vu1Thread.VsyncStats();
 
 	if (!CSRreg.VSINT)
 	{
@@ -20,6 +20,7 @@
 #include <cstdio>
 #include "../R5900.h"
 #include "../System.h"
+#include "../Memory.h"
 
 std::vector<BreakPoint> CBreakPoints::breakPoints_;
 u32 CBreakPoints::breakSkipFirstAt_ = 0;
@@ -328,6 +329,13 @@ void CBreakPoints::ChangeMemCheck(u32 start, u32 end, MemCheckCondition cond, Me
 	}
 }
 
+void CBreakPoints::CountMemCheckHit(u32 start, u32 end)
+{
+	size_t mc = FindMemCheck(start, end);
+	if (mc != INVALID_MEMCHECK)
+		++memChecks_[mc].numHits;
+}
+
 void CBreakPoints::ClearAllMemChecks()
 {
 	// This will ruin any pending memchecks.
@@ -399,6 +407,8 @@ void CBreakPoints::Update(u32 addr)
 //	else
 		SysClearExecutionCache();
 
+	mmap_UpdateWatchpoints();
+
 	if (resume)
 		r5900Debug.resumeCpu();
 	auto disassembly_window = wxGetApp().GetDisassemblyPtr();
@@ -132,6 +132,7 @@ public:
 	static void RemoveMemCheck(u32 start, u32 end);
 	static void ChangeMemCheck(u32 start, u32 end, MemCheckCondition cond, MemCheckResult result);
 	static void ClearAllMemChecks();
+	static void CountMemCheckHit(u32 start, u32 end);
 
 	static void SetSkipFirst(u32 pc);
 	static u32 CheckSkipFirst(u32 pc);
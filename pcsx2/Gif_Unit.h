@@ -226,9 +226,23 @@ struct Gif_Path {
 		Gif_MTGS_Wait(isMTVU());
 	}
 
+	// Hands the already parsed part of the current packet to the MTGS so that
+	// only the unparsed data has to be moved on realign (same as Gif_Unit's
+	// FlushToMTGS). Only done for the active path on a gif tag boundary, so the
+	// GS sees the same data stream, just split in two transfers.
+	void FlushParsedPacketData() {
+		if (isMTVU() || gifTag.isValid || !gsPack.size) return;
+		if (gifRegs.stat.APATH != idx + 1) return;
+		GS_Packet t = gsPack;
+		Gif_AddCompletedGSPacket(t, idx);
+		gsPack.offset = curOffset;
+		gsPack.size   = 0;
+	}
+
 	// Moves packet data to start of buffer
 	void RealignPacket() {
 		GUNIT_LOG("Path Buffer: Realigning packet!");
+		FlushParsedPacketData();
 		s32 offset    = curOffset - gsPack.size;
 		s32 sizeToAdd = curSize   - offset;
 		s32 intersect = sizeToAdd - offset;
@@ -0,0 +1,91 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2020  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+#include "Common.h"
+#include "IopCommon.h"
+#include "IopThread.h"
+
+IOP_Thread iopThread;
+
+IOP_Thread::IOP_Thread()
+{
+	m_name = L"IOP";
+	memzero(m_slice);
+}
+
+IOP_Thread::~IOP_Thread()
+{
+	try {
+		pxThread::Cancel();
+	}
+	DESTRUCTOR_CATCHALL
+}
+
+void IOP_Thread::ExecuteTaskInThread()
+{
+	PCSX2_PAGEFAULT_PROTECT {
+		for(;;) {
+			m_sema_slice.WaitWithoutYield();
+			RunSlice();
+			m_sema_done.Post();
+		}
+	} PCSX2_PAGEFAULT_EXCEPT;
+}
+
+void IOP_Thread::RunSlice()
+{
+	// The thread is only cancelled while idle, a slice always runs to completion.
+	int oldstate;
+	pthread_setcancelstate( PTHREAD_CANCEL_DISABLE, &oldstate );
+
+	try {
+		// The EE is blocked for the whole slice, nothing may have moved its clock.
+		pxAssert(m_slice.eeCycle == cpuRegs.cycle);
+
+		m_slice.eeCycles = psxCpu->ExecuteBlock(m_slice.eeCycles);
+		m_slice.iopCycle = psxRegs.cycle;
+	}
+	catch (...) {
+		m_except = std::current_exception();
+	}
+
+	pthread_setcancelstate( oldstate, NULL );
+}
+
+s32 IOP_Thread::ExecuteBlock(s32 eeCycles)
+{
+	if (!IsRunning()) Start();
+
+	m_slice.eeCycle  = cpuRegs.cycle;
+	m_slice.eeCycles = eeCycles;
+
+	// Cancelling the EE thread half-way would leave the IOP thread running on emulator
+	// state that is being torn down, so the wait can't be a cancellation point.
+	int oldstate;
+	pthread_setcancelstate( PTHREAD_CANCEL_DISABLE, &oldstate );
+	m_sema_slice.Post();
+	m_sema_done.WaitWithoutYield();
+	pthread_setcancelstate( oldstate, NULL );
+
+	if (m_except) {
+		std::exception_ptr ex;
+		std::swap(ex, m_except);
+		std::rethrow_exception(ex);
+	}
+
+	pxAssert(m_slice.iopCycle == psxRegs.cycle);
+	return m_slice.eeCycles;
+}
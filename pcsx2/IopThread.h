@@ -0,0 +1,64 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2020  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "System/SysThreads.h"
+#include <exception>
+
+// Runs the IOP timeslices handed out by the EE (see _cpuEventTest_Shared) on a dedicated
+// host thread when THREAD_IOP is enabled.
+//
+// The EE and IOP share SIF, DMA and interrupt state, and the emulation only stays
+// deterministic if every access to that state happens in the same order as in the
+// interleaved mode.  So the handoff is cycle-stamped and strictly in lockstep: the EE
+// posts a slice stamped with the EE cycle it reached and blocks until the IOP thread
+// returns the slice with the cycles left.  The sync point digest (iopSyncPointRecord)
+// and EmuConfig.Debugger.IopSyncCheck verify that this mode matches the single-threaded
+// one; any overlap of EE and IOP execution has to keep passing that check.
+//
+// Notes:
+// - ExecuteBlock should only be called from the EE thread.
+// - Exceptions thrown by the IOP are rethrown on the EE thread.
+class IOP_Thread : public pxThread
+{
+	typedef pxThread _parent;
+
+	struct Slice
+	{
+		u32 eeCycle;   // cpuRegs.cycle when the slice was handed out
+		s32 eeCycles;  // in: EE cycles the IOP may run, out: cycles left (as psxCpu->ExecuteBlock)
+		u32 iopCycle;  // psxRegs.cycle when the slice was returned
+	};
+
+	Slice     m_slice;
+	Semaphore m_sema_slice; // Posted by the EE when m_slice is ready
+	Semaphore m_sema_done;  // Posted by the IOP thread when m_slice was run
+	std::exception_ptr m_except;
+
+public:
+	IOP_Thread();
+	virtual ~IOP_Thread();
+
+	// Runs an IOP timeslice on the IOP thread and waits for it to complete
+	s32 ExecuteBlock(s32 eeCycles);
+
+protected:
+	void ExecuteTaskInThread();
+
+private:
+	void RunSlice();
+};
+
+extern IOP_Thread iopThread;
@@ -24,6 +24,15 @@ __aligned16 VU_Thread vu1Thread(CpuVU1, VU1);
 #define MTVU_ALWAYS_KICK 0
 #define MTVU_SYNC_MODE   0
 
+// Data-only packets (memory writes, unpacks, row/col) are not published to the VU
+// thread one by one: they are batched until this many u32 are pending, or until a
+// VU program is started or the EE needs to wait on the VU.
+static const s32 MTVU_BATCH_SIZE = _16kb / sizeof(u32);
+
+// Bounds of the adaptive spin of WaitVU, in pause iterations
+static const int MTVU_SPIN_MIN = 64;
+static const int MTVU_SPIN_MAX = 4096;
+
 // Rounds up a size in bytes for size in u32's
 static __fi u32 size_u32(u32 x) { return (x + 3) >> 2; }
 
@@ -85,6 +94,9 @@ void VU_Thread::Reset()
 	m_write_pos     = 0;
 	m_ato_read_pos  = 0;
 	m_read_pos      = 0;
+	m_merge_pos     = -1;
+	m_spin_count    = MTVU_SPIN_MIN;
+	memzero(stats);
 	memzero(vif);
 	memzero(vifRegs);
 	for (size_t i = 0; i < 4; ++i)
@@ -200,6 +212,9 @@ void VU_Thread::ReserveSpace(s32 size)
 	}
 
 	WaitOnSize(size);
+
+	stats.commands++;
+	m_merge_pos = -1;
 }
 
 // Use this when reading read_pos from ee thread
@@ -223,6 +238,10 @@ __fi u32* VU_Thread::GetWritePtr()
 
 __fi void VU_Thread::CommitWritePos()
 {
+	// Published packets belong to the VU thread, they can't be extended anymore
+	m_merge_pos = -1;
+	stats.commits++;
+
 	m_ato_write_pos.store(m_write_pos, std::memory_order_release);
 
 	if (MTVU_ALWAYS_KICK) KickStart();
@@ -234,6 +253,44 @@ __fi void VU_Thread::CommitReadPos()
 	m_ato_read_pos.store(m_read_pos, std::memory_order_release);
 }
 
+// Publishes the pending packets once enough of them have accumulated
+__fi void VU_Thread::CommitBatch()
+{
+	s32 pending = m_write_pos - m_ato_write_pos.load(std::memory_order_relaxed);
+
+	// A negative value means the ring wrapped, which already published everything before it
+	if (pending < 0 || pending >= MTVU_BATCH_SIZE) {
+		CommitWritePos();
+		KickStart();
+	}
+}
+
+// Appends the data to the previous unpublished write packet when it has the same
+// type and continues exactly where that one ends.
+__ri bool VU_Thread::MergeWrite(u32 tag, u32 addr, void* data, u32 size)
+{
+	if (m_merge_pos < 0 || buffer[m_merge_pos] != tag)
+		return false;
+
+	u32 prev_addr = buffer[m_merge_pos + 1];
+	u32 prev_size = buffer[m_merge_pos + 2];
+
+	if ((prev_size & 3) || prev_addr + prev_size != addr)
+		return false;
+
+	// The merged data must stay contiguous, don't wrap the ring for it
+	if (m_write_pos + (s32)size_u32(size) > (buffer_size - 1))
+		return false;
+
+	WaitOnSize(size_u32(size));
+
+	Write(data, size);
+	buffer[m_merge_pos + 2] = prev_size + size;
+
+	stats.merged++;
+	return true;
+}
+
 __fi u32 VU_Thread::Read()
 {
 	u32 ret = buffer[m_read_pos];
@@ -296,7 +353,11 @@ u32 VU_Thread::Get_vuCycles()
 void VU_Thread::KickStart(bool forceKick)
 {
 	if ((forceKick && !semaEvent.Count())
-	|| (!isBusy.load(std::memory_order_acquire) && GetReadPos() != m_ato_write_pos.load(std::memory_order_relaxed))) semaEvent.Post();
+	|| (!isBusy.load(std::memory_order_acquire) && GetReadPos() != m_ato_write_pos.load(std::memory_order_relaxed))) {
+		// Forced kicks come from the MTGS thread, stats are EE side only
+		if (!forceKick) stats.kicks++;
+		semaEvent.Post();
+	}
 }
 
 bool VU_Thread::IsDone()
@@ -307,6 +368,28 @@ bool VU_Thread::IsDone()
 void VU_Thread::WaitVU()
 {
 	MTVU_LOG("MTVU - WaitVU!");
+
+	if (m_write_pos != m_ato_write_pos.load(std::memory_order_relaxed))
+		CommitWritePos();
+
+	if (IsDone())
+		return;
+
+	stats.waits++;
+	KickStart();
+
+	// Short waits are common (the VU thread is usually just finishing a batch), so spin
+	// a little before yielding. The budget grows when spinning pays off and shrinks
+	// when it doesn't.
+	for (int i = 0; i < m_spin_count; i++) {
+		if (IsDone()) {
+			m_spin_count = std::min(m_spin_count * 2, MTVU_SPIN_MAX);
+			return;
+		}
+		_mm_pause();
+	}
+	m_spin_count = std::max(m_spin_count / 2, MTVU_SPIN_MIN);
+
 	for(;;) {
 		if (IsDone()) break;
 		//DevCon.WriteLn("WaitVU()");
@@ -317,6 +400,14 @@ void VU_Thread::WaitVU()
 	}
 }
 
+void VU_Thread::VsyncStats()
+{
+	if (stats.commands)
+		VIF_LOG("MTVU - %u commands (%u merged), %u commits, %u kicks, %u waits",
+			stats.commands, stats.merged, stats.commits, stats.kicks, stats.waits);
+	memzero(stats);
+}
+
 void VU_Thread::ExecuteVU(u32 vu_addr, u32 vif_top, u32 vif_itop)
 {
 	MTVU_LOG("MTVU - ExecuteVU!");
@@ -342,30 +433,35 @@ void VU_Thread::VifUnpack(vifStruct& _vif, VIFregisters& _vifRegs, u8* data, u32
 	WriteRegs(&_vifRegs);
 	Write(size);
 	Write(data, size);
-	CommitWritePos();
-	KickStart();
+	CommitBatch();
 }
 
 void VU_Thread::WriteMicroMem(u32 vu_micro_addr, void* data, u32 size)
 {
 	MTVU_LOG("MTVU - WriteMicroMem!");
-	ReserveSpace(3 + size_u32(size));
-	Write(MTVU_VU_WRITE_MICRO);
-	Write(vu_micro_addr);
-	Write(size);
-	Write(data, size);
-	CommitWritePos();
+	if (!MergeWrite(MTVU_VU_WRITE_MICRO, vu_micro_addr, data, size)) {
+		ReserveSpace(3 + size_u32(size));
+		m_merge_pos = m_write_pos;
+		Write(MTVU_VU_WRITE_MICRO);
+		Write(vu_micro_addr);
+		Write(size);
+		Write(data, size);
+	}
+	CommitBatch();
 }
 
 void VU_Thread::WriteDataMem(u32 vu_data_addr, void* data, u32 size)
 {
 	MTVU_LOG("MTVU - WriteDataMem!");
-	ReserveSpace(3 + size_u32(size));
-	Write(MTVU_VU_WRITE_DATA);
-	Write(vu_data_addr);
-	Write(size);
-	Write(data, size);
-	CommitWritePos();
+	if (!MergeWrite(MTVU_VU_WRITE_DATA, vu_data_addr, data, size)) {
+		ReserveSpace(3 + size_u32(size));
+		m_merge_pos = m_write_pos;
+		Write(MTVU_VU_WRITE_DATA);
+		Write(vu_data_addr);
+		Write(size);
+		Write(data, size);
+	}
+	CommitBatch();
 }
 
 void VU_Thread::WriteCol(vifStruct& _vif)
@@ -374,7 +470,7 @@ void VU_Thread::WriteCol(vifStruct& _vif)
 	ReserveSpace(1 + size_u32(sizeof(_vif.MaskCol)));
 	Write(MTVU_VIF_WRITE_COL);
 	Write(&_vif.MaskCol, sizeof(_vif.MaskCol));
-	CommitWritePos();
+	CommitBatch();
 }
 
 void VU_Thread::WriteRow(vifStruct& _vif)
@@ -383,5 +479,5 @@ void VU_Thread::WriteRow(vifStruct& _vif)
 	ReserveSpace(1 + size_u32(sizeof(_vif.MaskRow)));
 	Write(MTVU_VIF_WRITE_ROW);
 	Write(&_vif.MaskRow, sizeof(_vif.MaskRow));
-	CommitWritePos();
+	CommitBatch();
 }
@@ -36,6 +36,8 @@ class VU_Thread : public pxThread {
 	__aligned(64) std::atomic<int> m_ato_write_pos;    // Only modified by EE thread
 	__aligned(64) int  m_read_pos; // temporary read pos (local to the VU thread)
 	int  m_write_pos; // temporary write pos (local to the EE thread)
+	int  m_merge_pos; // pos of the last unpublished write packet that can still be extended, or -1
+	int  m_spin_count; // adaptive spin budget of WaitVU
 	Mutex     mtxBusy;
 	Semaphore semaEvent;
 	BaseVUmicroCPU*& vuCPU;
@@ -48,6 +50,15 @@ public:
 	__aligned(4) std::atomic<unsigned int> vuCycles[4]; // Used for VU cycle stealing hack
 	__aligned(4) u32 vuCycleIdx;  // Used for VU cycle stealing hack
 
+	// Per-frame EE side statistics, reported through the EE VIF trace log (see VsyncStats)
+	struct {
+		u32 commands; // packets written to the ring
+		u32 merged;   // data writes merged into the previous packet
+		u32 commits;  // write pos publications
+		u32 kicks;    // wake-ups of the VU thread
+		u32 waits;    // WaitVU calls that had to wait
+	} stats;
+
 	VU_Thread(BaseVUmicroCPU*& _vuCPU, VURegs& _vuRegs);
 	virtual ~VU_Thread();
 
@@ -76,6 +87,9 @@ public:
 
 	void WriteRow(vifStruct& _vif);
 
+	// Logs and clears the per-frame statistics
+	void VsyncStats();
+
 protected:
 	void ExecuteTaskInThread();
 
@@ -92,6 +106,8 @@ private:
 
 	void CommitWritePos();
 	void CommitReadPos();
+	void CommitBatch();
+	bool MergeWrite(u32 tag, u32 addr, void* data, u32 size);
 
 	u32 Read();
 	void Read(void* dest, u32 size);
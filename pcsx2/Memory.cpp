@@ -46,6 +46,7 @@ BIOS
 #include "ps2/BiosTools.h"
 
 #include "Utilities/PageFaultSource.h"
+#include "DebugTools/Breakpoints.h"
 
 #ifdef ENABLECACHE
 #include "Cache.h"
@@ -971,6 +972,147 @@ static __fi void mmap_ClearCpuBlock( uint offset )
 	Cpu->Clear( m_PageProtectInfo[rampage].ReverseRamMap, 0x400 );
 }
 
+// --------------------------------------------------------------------------------------
+//  Debugger write watchpoints
+// --------------------------------------------------------------------------------------
+// Opt-in (Debugger/PageProtectWatchpoints): write-only memchecks that lie in EE main ram
+// aren't instrumented by the recompiler. The pages they cover are write protected instead,
+// and the page fault handler checks the faulting address against their ranges. This trades
+// precision for speed, which is why the instrumented memchecks remain the default:
+//  - The faulting store can't be single-stepped, so the page is left writable for it to
+//    complete and is protected again on the next event test. Writes to the same page in
+//    between aren't seen.
+//  - The size of the store isn't known, only that it starts at the faulting address and
+//    doesn't cross a 16 byte boundary, so a range just past it can report a false hit.
+//  - A hit is reported (and pauses emulation) on the next event test, not at the store.
+
+struct mmap_WatchRange
+{
+	u32 start, end;		// standardized, physical main ram offsets
+	u32 vstart, vend;	// as set in the debugger
+	u32 result;
+};
+
+static bool m_PageWatched[Ps2MemSize::MainRam >> 12];
+static std::vector<mmap_WatchRange> m_WatchRanges;
+static bool m_WatchDirty = true;			// ranges must be rebuilt from the memchecks
+static volatile bool m_WatchReprotect;		// a watched page was unprotected by a write
+static volatile u32 m_WatchHitAddr;			// in the address space of the memcheck
+static volatile u32 m_WatchHitStart;
+static volatile u32 m_WatchHitEnd;
+static volatile u32 m_WatchHitResult;		// MemCheckResult of the hit, 0 if none pending
+
+bool mmap_CanWatchRange( u32 start, u32 end, u32 cond )
+{
+	if (!EmuConfig.Debugger.PageProtectWatchpoints) return false;
+	if (!EmuConfig.Cpu.Recompiler.EnableEE) return false;
+	if (cond != MEMCHECK_WRITE) return false; // reads and on-change checks must be instrumented
+
+	start = standardizeBreakpointAddress(start);
+	end   = standardizeBreakpointAddress(end);
+	return start < end && end <= Ps2MemSize::MainRam;
+}
+
+// Called when the memchecks change, the pages are updated on the next event test.
+void mmap_UpdateWatchpoints()
+{
+	m_WatchDirty = true;
+}
+
+static void mmap_ProtectWatchedPages()
+{
+	for (uint rampage = 0; rampage < ArraySize(m_PageWatched); rampage++)
+	{
+		if (m_PageWatched[rampage] && m_PageProtectInfo[rampage].Mode != ProtMode_Write)
+			HostSys::MemProtect( &eeMem->Main[rampage<<12], __pagesize, PageAccess_ReadOnly() );
+	}
+}
+
+static void mmap_RebuildWatchpoints()
+{
+	for (uint rampage = 0; rampage < ArraySize(m_PageWatched); rampage++)
+	{
+		if (m_PageWatched[rampage] && m_PageProtectInfo[rampage].Mode != ProtMode_Write)
+			HostSys::MemProtect( &eeMem->Main[rampage<<12], __pagesize, PageAccess_ReadWrite() );
+	}
+	memzero( m_PageWatched );
+	m_WatchRanges.clear();
+
+	for (const MemCheck& check : CBreakPoints::GetMemChecks())
+	{
+		if (!check.result || !mmap_CanWatchRange(check.start, check.end, check.cond))
+			continue;
+
+		mmap_WatchRange range;
+		range.start  = standardizeBreakpointAddress(check.start);
+		range.end    = standardizeBreakpointAddress(check.end);
+		range.vstart = check.start;
+		range.vend   = check.end;
+		range.result = check.result;
+		m_WatchRanges.push_back(range);
+
+		for (u32 page = range.start >> 12; page <= (range.end - 1) >> 12; page++)
+			m_PageWatched[page] = true;
+	}
+}
+
+// Returns true if a write to a watched range happened since the last call. Called from
+// the EE event test, which also re-protects the watched pages.
+bool mmap_CheckWatchpoints( u32& addr, u32& result )
+{
+	bool hit = m_WatchHitResult != 0;
+	if (hit)
+	{
+		addr   = m_WatchHitAddr;
+		result = m_WatchHitResult;
+		m_WatchHitResult = 0;
+		CBreakPoints::CountMemCheckHit(m_WatchHitStart, m_WatchHitEnd);
+	}
+
+	if (m_WatchDirty)
+	{
+		m_WatchDirty = false;
+		m_WatchReprotect = true;
+		mmap_RebuildWatchpoints();
+	}
+
+	if (m_WatchReprotect)
+	{
+		m_WatchReprotect = false;
+		mmap_ProtectWatchedPages();
+	}
+
+	return hit;
+}
+
+// Returns true if the fault was only caused by write watching (the page holds no
+// recompiled code), in which case the page has been made writable.
+static bool mmap_WatchFault( uint offset )
+{
+	int rampage = offset >> 12;
+	if (!m_PageWatched[rampage]) return false;
+
+	// The faulting store starts at offset and can't cross a 16 byte boundary.
+	u32 end = (offset | 15) + 1;
+	for (const mmap_WatchRange& range : m_WatchRanges)
+	{
+		if (offset < range.end && range.start < end)
+		{
+			m_WatchHitAddr    = range.vstart + (offset > range.start ? offset - range.start : 0);
+			m_WatchHitStart   = range.vstart;
+			m_WatchHitEnd     = range.vend;
+			m_WatchHitResult |= range.result;
+			cpuSetEvent();
+		}
+	}
+
+	m_WatchReprotect = true;
+	if (m_PageProtectInfo[rampage].Mode == ProtMode_Write) return false;
+
+	HostSys::MemProtect( &eeMem->Main[rampage<<12], __pagesize, PageAccess_ReadWrite() );
+	return true;
+}
+
 void mmap_PageFaultHandler::OnPageFaultEvent( const PageFaultInfo& info, bool& handled )
 {
 	pxAssert( eeMem );
@@ -979,7 +1121,8 @@ void mmap_PageFaultHandler::OnPageFaultEvent( const PageFaultInfo& info, bool& h
 	uptr offset = info.addr - (uptr)eeMem->Main;
 	if( offset >= Ps2MemSize::MainRam ) return;
 
-	mmap_ClearCpuBlock( offset );
+	if( !mmap_WatchFault( offset ) )
+		mmap_ClearCpuBlock( offset );
 	handled = true;
 }
 
@@ -992,4 +1135,5 @@ void mmap_ResetBlockTracking()
 	//DbgCon.WriteLn( "vtlb/mmap: Block Tracking reset..." );
 	memzero( m_PageProtectInfo );
 	if (eeMem) HostSys::MemProtect( eeMem->Main, Ps2MemSize::MainRam, PageAccess_ReadWrite() );
+	m_WatchReprotect = true;
 }
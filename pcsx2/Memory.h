@@ -128,6 +128,10 @@ extern vtlb_ProtectionMode mmap_GetRamPageInfo( u32 paddr );
 extern void mmap_MarkCountedRamPage( u32 paddr );
 extern void mmap_ResetBlockTracking();
 
+extern bool mmap_CanWatchRange( u32 start, u32 end, u32 cond );
+extern void mmap_UpdateWatchpoints();
+extern bool mmap_CheckWatchpoints( u32& addr, u32& result );
+
 #define memRead8 vtlb_memRead<mem8_t>
 #define memRead16 vtlb_memRead<mem16_t>
 #define memRead32 vtlb_memRead<mem32_t>
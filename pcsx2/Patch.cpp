@@ -32,10 +32,18 @@
 // the only consumer, so it's not made public via Patch.h
 // Applies a single patch line to emulation memory regardless of its "place" value.
 extern void _ApplyPatch(IniPatch *p);
+// Same for the compiled form of the continuous patches.
+extern void _CompilePatches(const std::vector<IniPatch>& patches, patch_place_type place);
+extern void _ApplyCompiledPatches(std::vector<IniPatch>& patches);
 
 
 std::vector<IniPatch> Patch;
 
+// Set when Patch changes, the continuous patches are recompiled on their next use.
+// The compiled size catches code that appends to Patch without setting the flag.
+static bool s_PatchesDirty = true;
+static size_t s_CompiledPatchCount = 0;
+
 wxString strgametitle;
 
 struct PatchTextTable
@@ -175,6 +183,7 @@ void inifile_process(wxTextFile &f1 )
 void ForgetLoadedPatches()
 {
 	Patch.clear();
+	s_PatchesDirty = true;
 }
 
 static int _LoadPatchFiles(const wxDirName& folderName, wxString& fileSpec, const wxString& friendlyName, int& numberFoundPatchFiles)
@@ -340,6 +349,7 @@ namespace PatchFunc
 
 			iPatch.enabled = 1; // omg success!!
 			Patch.push_back(iPatch);
+			s_PatchesDirty = true;
 
 		}
 		catch( wxString& exmsg )
@@ -354,6 +364,18 @@ namespace PatchFunc
 // This is for applying patches directly to memory
 void ApplyLoadedPatches(patch_place_type place)
 {
+	if (place == PPT_CONTINUOUSLY)
+	{
+		if (s_PatchesDirty || s_CompiledPatchCount != Patch.size())
+		{
+			_CompilePatches(Patch, PPT_CONTINUOUSLY);
+			s_CompiledPatchCount = Patch.size();
+			s_PatchesDirty = false;
+		}
+		_ApplyCompiledPatches(Patch);
+		return;
+	}
+
 	for (auto& i : Patch)
 	{
 		if (i.placetopatch == place)
@@ -20,6 +20,8 @@
 #include "IopCommon.h"
 #include "Patch.h"
 
+#include <vector>
+
 u32 SkipCount = 0, IterationCount = 0;
 u32 IterationIncrement = 0, ValueIncrement = 0;
 u32 PrevCheatType = 0, PrevCheatAddr = 0, LastType = 0;
@@ -449,3 +451,131 @@ void _ApplyPatch(IniPatch *p)
 		break;
 	}
 }
+
+// --------------------------------------------------------------------------------------
+//  Compiled patches
+// --------------------------------------------------------------------------------------
+// Continuous patches are applied on every vsync, so they are compiled once into a flat
+// list of typed operations. EE patches use virtual addresses and still compare through
+// the vtlb, IOP patches targeting main ram compare against host memory directly. Both
+// only go through the memory handlers when the value actually has to be written (so
+// recompiled code still gets invalidated). Everything else is kept in order and falls
+// back to _ApplyPatch.
+
+enum patch_op_type {
+	PATCH_OP_EE8,
+	PATCH_OP_EE16,
+	PATCH_OP_EE32,
+	PATCH_OP_EE64,
+	PATCH_OP_IOP_RAM8,
+	PATCH_OP_IOP_RAM16,
+	PATCH_OP_IOP_RAM32,
+	PATCH_OP_GENERIC
+};
+
+struct PatchOp
+{
+	patch_op_type op;
+	u32 addr;
+	u64 data;
+	u32 index; // Source patch index (used by PATCH_OP_GENERIC)
+};
+
+static std::vector<PatchOp> s_PatchOps;
+
+static patch_op_type _CompilePatchOp(const IniPatch& p)
+{
+	static const u32 size[] = { 0, 1, 2, 4, 8, 0 };
+	u32 bytes = size[p.type];
+
+	if (!bytes || (p.addr & (bytes - 1)))
+		return PATCH_OP_GENERIC;
+
+	if (p.cpu == CPU_EE)
+	{
+		switch (p.type)
+		{
+		case BYTE_T:   return PATCH_OP_EE8;
+		case SHORT_T:  return PATCH_OP_EE16;
+		case WORD_T:   return PATCH_OP_EE32;
+		case DOUBLE_T: return PATCH_OP_EE64;
+		default:       break;
+		}
+	}
+	else if (p.cpu == CPU_IOP && p.addr <= Ps2MemSize::IopRam - bytes)
+	{
+		switch (p.type)
+		{
+		case BYTE_T:   return PATCH_OP_IOP_RAM8;
+		case SHORT_T:  return PATCH_OP_IOP_RAM16;
+		case WORD_T:   return PATCH_OP_IOP_RAM32;
+		default:       break;
+		}
+	}
+
+	return PATCH_OP_GENERIC;
+}
+
+// Only used from Patch.cpp (see _ApplyPatch)
+void _CompilePatches(const std::vector<IniPatch>& patches, patch_place_type place)
+{
+	s_PatchOps.clear();
+
+	for (size_t i = 0; i < patches.size(); i++)
+	{
+		const IniPatch& p = patches[i];
+
+		if (!p.enabled || p.placetopatch != place)
+			continue;
+
+		PatchOp op = { _CompilePatchOp(p), p.addr, p.data, (u32)i };
+		s_PatchOps.push_back(op);
+	}
+}
+
+void _ApplyCompiledPatches(std::vector<IniPatch>& patches)
+{
+	for (auto& op : s_PatchOps)
+	{
+		switch (op.op)
+		{
+		case PATCH_OP_EE8:
+			if (memRead8(op.addr) != (u8)op.data)
+				memWrite8(op.addr, (u8)op.data);
+			break;
+		case PATCH_OP_EE16:
+			if (memRead16(op.addr) != (u16)op.data)
+				memWrite16(op.addr, (u16)op.data);
+			break;
+		case PATCH_OP_EE32:
+			if (memRead32(op.addr) != (u32)op.data)
+				memWrite32(op.addr, (u32)op.data);
+			break;
+		case PATCH_OP_EE64: {
+			u64 mem;
+			memRead64(op.addr, &mem);
+			if (mem != op.data)
+				memWrite64(op.addr, &op.data);
+			break;
+		}
+
+		case PATCH_OP_IOP_RAM8:
+			if (iopMem->Main[op.addr] != (u8)op.data)
+				iopMemWrite8(op.addr, (u8)op.data);
+			break;
+		case PATCH_OP_IOP_RAM16:
+			if (*(u16*)&iopMem->Main[op.addr] != (u16)op.data)
+				iopMemWrite16(op.addr, (u16)op.data);
+			break;
+		case PATCH_OP_IOP_RAM32:
+			if (*(u32*)&iopMem->Main[op.addr] != (u32)op.data)
+				iopMemWrite32(op.addr, (u32)op.data);
+			break;
+
+		case PATCH_OP_GENERIC:
+			if (op.index < patches.size())
+				_ApplyPatch(&patches[op.index]);
+			break;
+		}
+	}
+}
@@ -65,6 +65,7 @@ void Pcsx2Config::SpeedhackOptions::LoadSave( IniInterface& ini )
 	IniBitBool( WaitLoop );
 	IniBitBool( vuFlagHack );
 	IniBitBool( vuThread );
+	IniBitBool( iopThread );
 }
 
 void Pcsx2Config::ProfilerOptions::LoadSave( IniInterface& ini )
@@ -165,6 +166,8 @@ void Pcsx2Config::RecompilerOptions::LoadSave( IniInterface& ini )
 	IniBitBool( StackFrameChecks );
 	IniBitBool( PreBlockCheckEE );
 	IniBitBool( PreBlockCheckIOP );
+
+	IniBitBool( PrecompileVif );
 }
 
 Pcsx2Config::CpuOptions::CpuOptions()
@@ -390,11 +393,13 @@ Pcsx2Config::DebugOptions::DebugOptions()
 {
 	ShowDebuggerOnStart = false;
 	AlignMemoryWindowStart = true;
+	PageProtectWatchpoints = false;
 	FontWidth = 8;
 	FontHeight = 12;
 	WindowWidth = 0;
 	WindowHeight = 0;
 	MemoryViewBytesPerRow = 16;
+	IopSyncCheck = IopSyncCheck_Off;
 }
 
 void Pcsx2Config::DebugOptions::LoadSave( IniInterface& ini )
@@ -403,11 +408,13 @@ void Pcsx2Config::DebugOptions::LoadSave( IniInterface& ini )
 
 	IniBitBool( ShowDebuggerOnStart );
 	IniBitBool( AlignMemoryWindowStart );
+	IniBitBool( PageProtectWatchpoints );
 	IniBitfield( FontWidth );
 	IniBitfield( FontHeight );
 	IniBitfield( WindowWidth );
 	IniBitfield( WindowHeight );
 	IniBitfield( MemoryViewBytesPerRow );
+	IniBitfield( IopSyncCheck );
 }
 
 
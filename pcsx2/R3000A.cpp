@@ -50,6 +50,16 @@ bool iopEventTestIsActive = false;
 
 __aligned16 psxRegisters psxRegs;
 
+// Running digest of the EE<->IOP synchronization points (every IOP timeslice handed out
+// by the EE).  Only maintained while SIF tracing or the sync check is active; see
+// iopSyncPointRecord.
+static u32 iopSyncDigest = 0;
+static u32 iopSyncPoints = 0;
+static u32 iopSyncFrame = 0;
+static FILE* iopSyncTrace = NULL;
+
+static void iopSyncTraceOpen();
+
 void psxReset()
 {
 	memzero(psxRegs);
@@ -62,6 +72,10 @@ void psxReset()
 	iopCycleEE = -1;
 	g_iopNextEventCycle = psxRegs.cycle + 4;
 
+	iopSyncDigest = 0;
+	iopSyncPoints = 0;
+	iopSyncTraceOpen();
+
 	psxHwReset();
 	PSXCLK = 36864000;
 	ioman::reset();
@@ -247,3 +261,113 @@ void iopTestIntc()
 		psxSetNextBranchDelta( 2 );
 }
 
+// --------------------------------------------------------------------------------------
+//  IOP sync point tracing
+// --------------------------------------------------------------------------------------
+// The EE and IOP only observe each other's progress at the points where the EE hands the
+// IOP a timeslice.  Folding the cycle stamps and the IOP state visible at those points
+// into a running digest gives a cheap determinism check: two runs of the same content on
+// the same cpu cores (e.g. with a different EE/IOP scheduling mode) must log identical
+// per-vsync digests, and the first vsync where they differ pinpoints the divergence.
+// The cycle stamps are part of the digest, so interpreter and recompiler runs, which
+// count cycles differently, can't be compared this way.
+//
+// EmuConfig.Debugger.IopSyncCheck automates the comparison: the record mode writes every
+// per-vsync digest to iopsync.trace (next to the emulog), the compare mode reads them
+// back and reports the first vsync that diverged.  The trace is (re)opened by psxReset,
+// so both runs have to start from a boot of the same content; loading a savestate
+// in-between invalidates the comparison.
+
+static void iopSyncTraceClose()
+{
+	if( iopSyncTrace != NULL )
+	{
+		fclose( iopSyncTrace );
+		iopSyncTrace = NULL;
+	}
+}
+
+static void iopSyncTraceOpen()
+{
+	iopSyncTraceClose();
+	iopSyncFrame = 0;
+
+	const uint mode = EmuConfig.Debugger.IopSyncCheck;
+	if( mode != IopSyncCheck_Record && mode != IopSyncCheck_Compare ) return;
+
+	const wxString filename( Path::Combine( Path::GetDirectory(emuLogName), L"iopsync.trace" ) );
+	iopSyncTrace = wxFopen( filename, (mode == IopSyncCheck_Record) ? L"wb" : L"rb" );
+
+	if( iopSyncTrace == NULL )
+		Console.Error( L"IOP sync: cannot open %s", WX_STR(filename) );
+	else
+		Console.WriteLn( Color_StrongBlue, L"IOP sync: %s %s (%s IOP)",
+			(mode == IopSyncCheck_Record) ? L"recording to" : L"comparing against", WX_STR(filename),
+			THREAD_IOP ? L"threaded" : L"single-threaded" );
+}
+
+static __fi bool iopSyncPointsActive()
+{
+	return (iopSyncTrace != NULL) || SysTraceActive(SIF);
+}
+
+void iopSyncPointRecord( s32 eeCyclesLeft )
+{
+	if( !iopSyncPointsActive() ) return;
+
+	const u32 stamp[] =
+	{
+		cpuRegs.cycle, psxRegs.cycle, (u32)eeCyclesLeft, psxRegs.pc,
+		psxRegs.interrupt, psxHu32(0x1070), psxHu32(0x1074)
+	};
+
+	// FNV-1a, word at a time.
+	u32 hash = iopSyncDigest ^ 0x811c9dc5;
+	for( uint i = 0; i < ArraySize(stamp); ++i )
+		hash = (hash ^ stamp[i]) * 0x01000193;
+
+	iopSyncDigest = hash;
+	iopSyncPoints++;
+}
+
+void iopSyncPointVsync()
+{
+	if( !iopSyncPointsActive() ) return;
+
+	SIF_LOG( "IOP sync: %u points this frame, digest = 0x%08x (EE cycle %u, IOP cycle %u)",
+		iopSyncPoints, iopSyncDigest, cpuRegs.cycle, psxRegs.cycle );
+
+	if( iopSyncTrace != NULL )
+	{
+		const u32 entry[2] = { iopSyncPoints, iopSyncDigest };
+
+		if( EmuConfig.Debugger.IopSyncCheck == IopSyncCheck_Record )
+		{
+			if( fwrite( entry, sizeof(entry), 1, iopSyncTrace ) != 1 )
+			{
+				Console.Error( "IOP sync: write error at vsync %u, recording stopped", iopSyncFrame );
+				iopSyncTraceClose();
+			}
+		}
+		else
+		{
+			u32 ref[2];
+
+			if( fread( ref, sizeof(ref), 1, iopSyncTrace ) != 1 )
+			{
+				Console.WriteLn( Color_StrongBlue, "IOP sync: reference trace ends at vsync %u, no divergence found", iopSyncFrame );
+				iopSyncTraceClose();
+			}
+			else if( ref[0] != entry[0] || ref[1] != entry[1] )
+			{
+				// Every later digest differs too, only the first divergence is useful.
+				Console.Error( "IOP sync: vsync %u diverged from the reference trace (%u points, digest 0x%08x; expected %u points, digest 0x%08x)",
+					iopSyncFrame, entry[0], entry[1], ref[0], ref[1] );
+				iopSyncTraceClose();
+			}
+		}
+	}
+
+	iopSyncFrame++;
+	iopSyncPoints = 0;
+}
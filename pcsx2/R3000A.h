@@ -201,6 +201,8 @@ extern R3000Acpu psxRec;
 extern void psxReset();
 extern void __fastcall psxException(u32 code, u32 step);
 extern void iopEventTest();
+extern void iopSyncPointRecord( s32 eeCyclesLeft );
+extern void iopSyncPointVsync();
 extern void psxMemReset();
 
 // Subsets
@@ -23,6 +23,7 @@
 #include "VUmicro.h"
 #include "COP0.h"
 #include "MTVU.h"
+#include "IopThread.h"
 
 #include "System/SysThreads.h"
 #include "R5900Exceptions.h"
@@ -352,6 +353,23 @@ static __fi void _cpuTestPERF()
 // them out.  Exceptions while the exception handler is active (EIE), or exceptions of any
 // level other than 0 are ignored here.
 
+// Reports writes caught by the page protection based memchecks (see mmap_CanWatchRange).
+static __fi void _cpuTestWatchpoints()
+{
+	u32 addr, result;
+	if (!mmap_CheckWatchpoints(addr, result)) return;
+
+	if (result & MEMCHECK_LOG)
+		DevCon.WriteLn("Hit store breakpoint @0x%x", addr);
+
+	if ((result & MEMCHECK_BREAK) && CBreakPoints::CheckSkipFirst(cpuRegs.pc) == 0)
+	{
+		CBreakPoints::SetBreakpointTriggered(true);
+		GetCoreThread().PauseSelfDebug();
+		Cpu->CheckExecutionState();
+	}
+}
+
 static bool cpuIntsEnabled(int Interrupt)
 {
 	bool IntType = !!(cpuRegs.CP0.n.Status.val & Interrupt); //Choose either INTC or DMAC, depending on what called it
@@ -394,6 +412,8 @@ __fi void _cpuEventTest_Shared()
 
 	_cpuTestTIMR();
 
+	_cpuTestWatchpoints();
+
 	// ---- Interrupts -------------
 	// These are basically just DMAC-related events, which also piggy-back the same bits as
 	// the PS2's own DMA channel IRQs and IRQ Masks.
@@ -422,7 +442,8 @@ __fi void _cpuEventTest_Shared()
 		//if( EEsCycle < -450 )
 		//	Console.WriteLn( " IOP ahead by: %d cycles", -EEsCycle );
 
-		EEsCycle = psxCpu->ExecuteBlock( EEsCycle );
+		EEsCycle = THREAD_IOP ? iopThread.ExecuteBlock( EEsCycle ) : psxCpu->ExecuteBlock( EEsCycle );
+		iopSyncPointRecord( EEsCycle );
 
 		iopEventAction = false;
 	}
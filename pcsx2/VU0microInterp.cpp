@@ -21,16 +21,19 @@
 
 extern void _vuFlushAll(VURegs* VU);
 
-static void _vu0ExecUpper(VURegs* VU, u32 *ptr) {
+// Predecoded instruction pairs, indexed by micro memory slot
+static _VUDecoded vu0Decoded[VU0_PROGSIZE / 8];
+
+static void _vu0ExecUpper(VURegs* VU, u32 *ptr, const _VUDecoded& d) {
 	VU->code = ptr[1];
 	IdebugUPPER(VU0);
-	VU0_UPPER_OPCODE[VU->code & 0x3f]();
+	d.upper();
 }
 
-static void _vu0ExecLower(VURegs* VU, u32 *ptr) {
+static void _vu0ExecLower(VURegs* VU, u32 *ptr, const _VUDecoded& d) {
 	VU->code = ptr[0];
 	IdebugLOWER(VU0);
-	VU0_LOWER_OPCODE[VU->code >> 25]();
+	d.lower();
 }
 
 int vu0branch = 0;
@@ -48,8 +51,12 @@ static void _vu0Exec(VURegs* VU)
 	int discard=0;
 
 	ptr = (u32*)&VU->Micro[VU->VI[REG_TPC].UL];
+	_VUDecoded& d = vu0Decoded[VU->VI[REG_TPC].UL >> 3];
 	VU->VI[REG_TPC].UL+=8;
 
+	if (!d.valid || d.code != *(u64*)ptr)
+		_vuDecode(VU, d, ptr);
+
 	if (ptr[1] & 0x40000000) {
 		VU->ebit = 2;
 	}
@@ -74,52 +81,34 @@ static void _vu0Exec(VURegs* VU)
 		
 	}
 
-	VU->code = ptr[1];
-	VU0regs_UPPER_OPCODE[VU->code & 0x3f](&uregs);
+	uregs = d.uregs;
 #ifndef INT_VUSTALLHACK
 	_vuTestUpperStalls(VU, &uregs);
 #endif
 
 	/* check upper flags */
 	if (ptr[1] & 0x80000000) { /* I flag */
-		_vu0ExecUpper(VU, ptr);
+		_vu0ExecUpper(VU, ptr, d);
 
 		VU->VI[REG_I].UL = ptr[0];
-		memset(&lregs, 0, sizeof(lregs));
+		lregs = d.lregs;
 	} else {
-		VU->code = ptr[0];
-		VU0regs_LOWER_OPCODE[VU->code >> 25](&lregs);
+		lregs = d.lregs;
 #ifndef INT_VUSTALLHACK
 		_vuTestLowerStalls(VU, &lregs);
 #endif
 
 		vu0branch = lregs.pipe == VUPIPE_BRANCH;
 
-		vfreg = 0; vireg = 0;
-		if (uregs.VFwrite) {
-			if (lregs.VFwrite == uregs.VFwrite) {
-//				Console.Warning("*PCSX2*: Warning, VF write to the same reg in both lower/upper cycle");
-				discard = 1;
-			}
-			if (lregs.VFread0 == uregs.VFwrite ||
-				lregs.VFread1 == uregs.VFwrite) {
-//				Console.WriteLn("saving reg %d at pc=%x", i, VU->VI[REG_TPC].UL);
-				_VF = VU->VF[uregs.VFwrite];
-				vfreg = uregs.VFwrite;
-			}
-		}
-		if (uregs.VIread & (1 << REG_CLIP_FLAG)) {
-			if (lregs.VIwrite & (1 << REG_CLIP_FLAG)) {
-				Console.Warning("*PCSX2*: Warning, VI write to the same reg in both lower/upper cycle");
-				discard = 1;
-			}
-			if (lregs.VIread & (1 << REG_CLIP_FLAG)) {
-				_VI = VU0.VI[REG_CLIP_FLAG];
-				vireg = REG_CLIP_FLAG;
-			}
-		}
+		vfreg = d.vfreg;
+		vireg = d.vireg;
+		discard = d.discard;
+		if (d.clipWrite)
+			Console.Warning("*PCSX2*: Warning, VI write to the same reg in both lower/upper cycle");
+		if (vfreg) _VF = VU->VF[vfreg];
+		if (vireg) _VI = VU0.VI[vireg];
 
-		_vu0ExecUpper(VU, ptr);
+		_vu0ExecUpper(VU, ptr, d);
 
 		if (discard == 0) {
 			if (vfreg) {
@@ -131,7 +120,7 @@ static void _vu0Exec(VURegs* VU)
 				VU->VI[vireg] = _VI;
 			}
 
-			_vu0ExecLower(VU, ptr);
+			_vu0ExecLower(VU, ptr, d);
 
 			if (vfreg) {
 				VU->VF[vfreg] = _VFc;
@@ -198,6 +187,18 @@ InterpVU0::InterpVU0()
 	IsInterpreter = true;
 }
 
+void InterpVU0::Reset()
+{
+	Clear(0, VU0_PROGSIZE);
+}
+
+// Drops the predecoded entries of the micro memory range being written
+void InterpVU0::Clear(u32 addr, u32 size)
+{
+	for (u32 i = addr / 8; i < std::min<u32>((addr + size + 7) / 8, VU0_PROGSIZE / 8); i++)
+		vu0Decoded[i].valid = false;
+}
+
 void InterpVU0::Step()
 {
 	vu0Exec( &VU0 );
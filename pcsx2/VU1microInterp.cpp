@@ -22,16 +22,19 @@
 
 extern void _vuFlushAll(VURegs* VU);
 
-void _vu1ExecUpper(VURegs* VU, u32 *ptr) {
+// Predecoded instruction pairs, indexed by micro memory slot
+static _VUDecoded vu1Decoded[VU1_PROGSIZE / 8];
+
+void _vu1ExecUpper(VURegs* VU, u32 *ptr, const _VUDecoded& d) {
 	VU->code = ptr[1];
 	//IdebugUPPER(VU1);
-	VU1_UPPER_OPCODE[VU->code & 0x3f]();
+	d.upper();
 }
 
-void _vu1ExecLower(VURegs* VU, u32 *ptr) {
+void _vu1ExecLower(VURegs* VU, u32 *ptr, const _VUDecoded& d) {
 	VU->code = ptr[0];
 	IdebugLOWER(VU1);
-	VU1_LOWER_OPCODE[VU->code >> 25]();
+	d.lower();
 }
 
 int vu1branch = 0;
@@ -50,8 +53,12 @@ static void _vu1Exec(VURegs* VU)
 	int discard=0;
 
 	ptr = (u32*)&VU->Micro[VU->VI[REG_TPC].UL];
+	_VUDecoded& d = vu1Decoded[VU->VI[REG_TPC].UL >> 3];
 	VU->VI[REG_TPC].UL+=8;
 
+	if (!d.valid || d.code != *(u64*)ptr)
+		_vuDecode(VU, d, ptr);
+
 	if (ptr[1] & 0x40000000) { /* E flag */
 		VU->ebit = 2;
 	}
@@ -74,54 +81,36 @@ static void _vu1Exec(VURegs* VU)
 
 	//VUM_LOG("VU->cycle = %d (flags st=%x;mac=%x;clip=%x,q=%f)", VU->cycle, VU->statusflag, VU->macflag, VU->clipflag, VU->q.F);
 
-	VU->code = ptr[1];
-	VU1regs_UPPER_OPCODE[VU->code & 0x3f](&uregs);
+	uregs = d.uregs;
 #ifndef INT_VUSTALLHACK
 	_vuTestUpperStalls(VU, &uregs);
 #endif
 
 	/* check upper flags */
 	if (ptr[1] & 0x80000000) { /* I flag */
-		_vu1ExecUpper(VU, ptr);
+		_vu1ExecUpper(VU, ptr, d);
 
 		VU->VI[REG_I].UL = ptr[0];
-		//Lower not used, set to 0 to fill in the FMAC stall gap
+		//Lower not used, decoded as 0 to fill in the FMAC stall gap
 		//Could probably get away with just running upper stalls, but lets not tempt fate.
-		memset(&lregs, 0, sizeof(lregs));		
+		lregs = d.lregs;
 	} else {
-		VU->code = ptr[0];
-		VU1regs_LOWER_OPCODE[VU->code >> 25](&lregs);
+		lregs = d.lregs;
 #ifndef INT_VUSTALLHACK
 		_vuTestLowerStalls(VU, &lregs);
 #endif
 
 		vu1branch = lregs.pipe == VUPIPE_BRANCH;
 
-		vfreg = 0; vireg = 0;
-		if (uregs.VFwrite) {
-			if (lregs.VFwrite == uregs.VFwrite) {
-//				Console.Warning("*PCSX2*: Warning, VF write to the same reg in both lower/upper cycle");
-				discard = 1;
-			}
-			if (lregs.VFread0 == uregs.VFwrite ||
-				lregs.VFread1 == uregs.VFwrite) {
-//				Console.WriteLn("saving reg %d at pc=%x", i, VU->VI[REG_TPC].UL);
-				_VF = VU->VF[uregs.VFwrite];
-				vfreg = uregs.VFwrite;
-			}
-		}
-		if (uregs.VIread & (1 << REG_CLIP_FLAG)) {
-			if (lregs.VIwrite & (1 << REG_CLIP_FLAG)) {
-				Console.Warning("*PCSX2*: Warning, VI write to the same reg in both lower/upper cycle");
-				discard = 1;
-			}
-			if (lregs.VIread & (1 << REG_CLIP_FLAG)) {
-				_VI = VU->VI[REG_CLIP_FLAG];
-				vireg = REG_CLIP_FLAG;
-			}
-		}
+		vfreg = d.vfreg;
+		vireg = d.vireg;
+		discard = d.discard;
+		if (d.clipWrite)
+			Console.Warning("*PCSX2*: Warning, VI write to the same reg in both lower/upper cycle");
+		if (vfreg) _VF = VU->VF[vfreg];
+		if (vireg) _VI = VU->VI[vireg];
 
-		_vu1ExecUpper(VU, ptr);
+		_vu1ExecUpper(VU, ptr, d);
 
 		if (discard == 0) {
 			if (vfreg) {
@@ -133,7 +122,7 @@ static void _vu1Exec(VURegs* VU)
 				VU->VI[vireg] = _VI;
 			}
 
-			_vu1ExecLower(VU, ptr);
+			_vu1ExecLower(VU, ptr, d);
 
 			if (vfreg) {
 				VU->VF[vfreg] = _VFc;
@@ -196,12 +185,20 @@ InterpVU1::InterpVU1()
 
 void InterpVU1::Reset() {
 	vu1Thread.WaitVU();
+	Clear(0, VU1_PROGSIZE);
 }
 
 void InterpVU1::Shutdown() noexcept {
 	vu1Thread.WaitVU();
 }
 
+// Drops the predecoded entries of the micro memory range being written
+void InterpVU1::Clear(u32 addr, u32 size)
+{
+	for (u32 i = addr / 8; i < std::min<u32>((addr + size + 7) / 8, VU1_PROGSIZE / 8); i++)
+		vu1Decoded[i].valid = false;
+}
+
 void InterpVU1::Step()
 {
 	VU1.VI[REG_TPC].UL &= VU1_PROGMASK;
@@ -177,11 +177,11 @@ public:
 
 	void Reserve() { }
 	void Shutdown() noexcept { }
-	void Reset() { }
+	void Reset();
 
 	void Step();
 	void Execute(u32 cycles);
-	void Clear(u32 addr, u32 size) {}
+	void Clear(u32 addr, u32 size);
 
 	uint GetCacheReserve() const { return 0; }
 	void SetCacheReserve( uint reserveInMegs ) const {}
@@ -202,7 +202,7 @@ public:
 
 	void Step();
 	void Execute(u32 cycles);
-	void Clear(u32 addr, u32 size) {}
+	void Clear(u32 addr, u32 size);
 	void ResumeXGkick() {}
 
 	uint GetCacheReserve() const { return 0; }
@@ -4117,6 +4117,43 @@ _vuTablesPost(VU1, VU1)
 _vuRegsTables(VU0, VU0regs, Fnptr_VuRegsN)
 _vuRegsTables(VU1, VU1regs, Fnptr_VuRegsN)
 
+// Decodes the instruction pair at ptr, including the hazard checks between
+// the upper and lower op which the interpreters used to redo on every step.
+void _vuDecode(VURegs * VU, _VUDecoded& d, const u32* ptr)
+{
+	const bool vu1 = VU->IsVU1();
+
+	memzero(d);
+	d.code = *(u64*)ptr;
+
+	VU->code = ptr[1];
+	d.upper = (vu1 ? VU1_UPPER_OPCODE : VU0_UPPER_OPCODE)[VU->code & 0x3f];
+	(vu1 ? VU1regs_UPPER_OPCODE : VU0regs_UPPER_OPCODE)[VU->code & 0x3f](&d.uregs);
+
+	if (!(ptr[1] & 0x80000000)) { /* I flag */
+		VU->code = ptr[0];
+		d.lower = (vu1 ? VU1_LOWER_OPCODE : VU0_LOWER_OPCODE)[VU->code >> 25];
+		(vu1 ? VU1regs_LOWER_OPCODE : VU0regs_LOWER_OPCODE)[VU->code >> 25](&d.lregs);
+
+		if (d.uregs.VFwrite) {
+			if (d.lregs.VFwrite == d.uregs.VFwrite)
+				d.discard = true;
+			if (d.lregs.VFread0 == d.uregs.VFwrite || d.lregs.VFread1 == d.uregs.VFwrite)
+				d.vfreg = d.uregs.VFwrite;
+		}
+		if (d.uregs.VIread & (1 << REG_CLIP_FLAG)) {
+			if (d.lregs.VIwrite & (1 << REG_CLIP_FLAG)) {
+				d.clipWrite = true;
+				d.discard   = true;
+			}
+			if (d.lregs.VIread & (1 << REG_CLIP_FLAG))
+				d.vireg = REG_CLIP_FLAG;
+		}
+	}
+
+	d.valid = true;
+}
+
 
 // --------------------------------------------------------------------------------------
 //  VU0macro (COP2)
@@ -54,6 +54,24 @@ extern __aligned16 const Fnptr_Void VU1_UPPER_OPCODE[64];
 extern __aligned16 const Fnptr_VuRegsN VU1regs_LOWER_OPCODE[128];
 extern __aligned16 const Fnptr_VuRegsN VU1regs_UPPER_OPCODE[64];
 
+// Predecoded upper/lower instruction pair. The VU interpreters keep one per
+// micro memory slot so opcode lookup and register analysis only run once per
+// program word instead of on every step.
+struct _VUDecoded {
+	u64 code;         // Raw instruction pair this entry was decoded from
+	Fnptr_Void upper;
+	Fnptr_Void lower; // NULL when the I bit is set
+	_VURegsNum uregs;
+	_VURegsNum lregs;
+	u8 vfreg;         // VF reg the lower op must read before the upper write, or 0
+	u8 vireg;         // Same for the clip flag, or 0
+	bool discard;     // Lower op is skipped (upper writes the same register)
+	bool clipWrite;   // Both ops write the clip flag
+	bool valid;
+};
+
+extern void _vuDecode(VURegs * VU, _VUDecoded& d, const u32* ptr);
+
 extern void _vuTestPipes(VURegs * VU);
 extern void _vuTestUpperStalls(VURegs * VU, _VURegsNum *VUregsn);
 extern void _vuTestLowerStalls(VURegs * VU, _VURegsNum *VUregsn);
@@ -19,6 +19,7 @@
 #include "ConsoleLogger.h"
 #include "MSWstuff.h"
 #include "MTVU.h" // for thread cancellation on shutdown
+#include "IopThread.h"
 
 #include "Utilities/IniInterface.h"
 #include "DebugTools/Debug.h"
@@ -747,6 +748,7 @@ Pcsx2App::~Pcsx2App()
 	pxDoAssert = pxAssertImpl_LogIt;	
 	try {
 		vu1Thread.Cancel();
+		iopThread.Cancel();
 	}
 	DESTRUCTOR_CATCHALL
 }
@@ -40,19 +40,32 @@ struct Component_FileMcd;
 
 #include <wx/ffile.h>
 #include <map>
+#include <memory>
 
 static const int MCD_SIZE	= 1024 *  8  * 16;		// Legacy PSX card default size
 
 static const int MC2_MBSIZE	= 1024 * 528 * 2;		// Size of a single megabyte of card data
 
+class FileMcdFlushThread;
+
 // --------------------------------------------------------------------------------------
 //  FileMemoryCard
 // --------------------------------------------------------------------------------------
-// Provides thread-safe direct file IO mapping.
+// Keeps an in-memory image of each card file.  Reads and writes only touch the image;
+// modified blocks are written back to the file by a background thread once a card has
+// seen no writes for a few frames, and when the card is closed.
 //
 class FileMemoryCard
 {
+	friend class FileMcdFlushThread;
+
 protected:
+	// Granularity of the dirty tracking, one erase block (16 sectors of 528 bytes).
+	static const uint FlushBlockSize = 528 * 16;
+
+	// Flush the image to the file after this many frames of no writes.
+	static const int FramesAfterWriteUntilFlush = 2;
+
 	wxFFile			m_file[8];
 	u8				m_effeffs[528*16];
 	SafeArray<u8>	m_currentdata;
@@ -60,9 +73,20 @@ protected:
 	bool			m_ispsx[8];
 	u32				m_chkaddr;
 
+	std::vector<u8>	m_image[8];			// contents of the whole card file
+	std::vector<u8>	m_dirty[8];			// one flag per FlushBlockSize bytes of m_image
+	u32				m_offset[8];		// offset of the card data in the file (legacy PSX headers)
+	int				m_framesUntilFlush[8];
+
+	Threading::Mutex	m_mtx_image;	// guards m_image writes and m_dirty
+	Threading::Mutex	m_mtx_file;		// guards m_file
+	std::vector<u8>		m_flushbuf;		// flush thread copy of the dirty blocks
+
+	std::unique_ptr<FileMcdFlushThread> m_flushThread;
+
 public:
 	FileMemoryCard();
-	virtual ~FileMemoryCard() = default;
+	virtual ~FileMemoryCard();
 
 	void Lock();
 	void Unlock();
@@ -77,9 +101,13 @@ public:
 	s32  Save		( uint slot, const u8 *src, u32 adr, int size );
 	s32  EraseBlock	( uint slot, u32 adr );
 	u64  GetCRC		( uint slot );
+	void NextFrame	( uint slot );
 
 protected:
-	bool Seek( wxFFile& f, u32 adr );
+	bool Load( uint slot );
+	bool InRange( uint slot, u32 adr, int size ) const;
+	void WriteImage( uint slot, u32 adr, const u8* src, int size );
+	void WriteBack();
 	bool Create( const wxString& mcdFile, uint sizeInMB );
 
 	wxString GetDisabledMessage( uint slot ) const
@@ -143,14 +171,69 @@ wxString FileMcd_GetDefaultName(uint slot)
 		return wxsFormat( L"Mcd%03u.ps2", slot+1 );
 }
 
+// --------------------------------------------------------------------------------------
+//  FileMcdFlushThread
+// --------------------------------------------------------------------------------------
+// Writes the dirty blocks of the memory card images back to their files, so that game
+// saves don't stall the emulation on disk IO.
+//
+class FileMcdFlushThread : public Threading::pxThread
+{
+protected:
+	FileMemoryCard&			m_mcd;
+	Threading::Semaphore	m_sem_event;
+
+public:
+	FileMcdFlushThread( FileMemoryCard& mcd )
+		: m_mcd( mcd )
+	{
+		m_name = L"FileMcd Flush";
+	}
+
+	virtual ~FileMcdFlushThread()
+	{
+		try {
+			pxThread::Cancel();
+		}
+		DESTRUCTOR_CATCHALL
+	}
+
+	void Kick()
+	{
+		m_sem_event.Post();
+	}
+
+protected:
+	void ExecuteTaskInThread()
+	{
+		for(;;) {
+			m_sem_event.WaitWithoutYield();
+			m_mcd.WriteBack();
+		}
+	}
+};
+
 FileMemoryCard::FileMemoryCard()
 {
 	memset8<0xff>( m_effeffs );
 	m_chkaddr = 0;
+
+	for( int slot=0; slot<8; ++slot )
+	{
+		m_offset[slot] = 0;
+		m_framesUntilFlush[slot] = 0;
+	}
+
+	m_flushThread.reset( new FileMcdFlushThread( *this ) );
 }
 
+FileMemoryCard::~FileMemoryCard() = default;
+
 void FileMemoryCard::Open()
 {
+	ScopedLock lock( m_mtx_file );
+	m_flushThread->Start();
+
 	for( int slot=0; slot<8; ++slot )
 	{
 		if( FileMcd_IsMultitapSlot(slot) )
@@ -206,10 +289,11 @@ void FileMemoryCard::Open()
 		NTFS_CompressFile( str, g_Conf->McdCompressNTFS );
 #endif
 
-		if( !m_file[slot].Open( str.c_str(), L"r+b" ) )
+		if( !m_file[slot].Open( str.c_str(), L"r+b" ) || !Load( slot ) )
 		{
 			// Translation note: detailed description should mention that the memory card will be disabled
 			// for the duration of this session.
+			m_file[slot].Close();
 			Msgbox::Alert(
 				wxsFormat(_( "Access denied to memory card: \n\n%s\n\n" ), str.c_str()) +
 				GetDisabledMessage( slot )
@@ -217,17 +301,20 @@ void FileMemoryCard::Open()
 		}
 		else // Load checksum
 		{
-			m_ispsx[slot] = m_file[slot].Length() == 0x20000;
+			m_ispsx[slot] = m_image[slot].size() == 0x20000;
 			m_chkaddr = 0x210;
 
-			if(!m_ispsx[slot] && !!m_file[slot].Seek( m_chkaddr ))
-				m_file[slot].Read( &m_chksum[slot], 8 );
+			if(!m_ispsx[slot] && m_image[slot].size() >= m_chkaddr + 8)
+				memcpy( &m_chksum[slot], &m_image[slot][m_chkaddr], 8 );
 		}
 	}
 }
 
 void FileMemoryCard::Close()
 {
+	WriteBack();
+
+	ScopedLock lock( m_mtx_file );
 	for( int slot=0; slot<8; ++slot )
 	{
 		if (m_file[slot].IsOpened()) {
@@ -237,12 +324,17 @@ void FileMemoryCard::Close()
 
 			m_file[slot].Close();
 		}
+
+		m_image[slot].clear();
+		m_dirty[slot].clear();
+		m_framesUntilFlush[slot] = 0;
 	}
 }
 
-// Returns FALSE if the seek failed (is outside the bounds of the file).
-bool FileMemoryCard::Seek( wxFFile& f, u32 adr )
+// Reads the whole card file into its image.  Returns FALSE on read errors.
+bool FileMemoryCard::Load( uint slot )
 {
+	wxFFile& f( m_file[slot] );
 	const u32 size = f.Length();
 
 	// If anyone knows why this filesize logic is here (it appears to be related to legacy PSX
@@ -260,7 +352,92 @@ bool FileMemoryCard::Seek( wxFFile& f, u32 adr )
 		// perform sanity checks here?
 	}
 
-	return f.Seek( adr + offset );
+	m_offset[slot] = offset;
+	m_image[slot].resize( size );
+	m_dirty[slot].assign( (size + FlushBlockSize - 1) / FlushBlockSize, 0 );
+	m_framesUntilFlush[slot] = 0;
+
+	return size && f.Seek( 0 ) && f.Read( m_image[slot].data(), size ) == size;
+}
+
+// Returns FALSE if the access is outside the bounds of the file.
+bool FileMemoryCard::InRange( uint slot, u32 adr, int size ) const
+{
+	return size >= 0 && (u64)adr + m_offset[slot] + size <= m_image[slot].size();
+}
+
+// Writes to the image and schedules the touched blocks for writing back to the file.
+void FileMemoryCard::WriteImage( uint slot, u32 adr, const u8* src, int size )
+{
+	if( size <= 0 ) return;
+
+	const u32 pos = adr + m_offset[slot];
+
+	ScopedLock lock( m_mtx_image );
+	memcpy( &m_image[slot][pos], src, size );
+
+	for( u32 block = pos / FlushBlockSize; block <= (pos + size - 1) / FlushBlockSize; ++block )
+		m_dirty[slot][block] = 1;
+
+	m_framesUntilFlush[slot] = FramesAfterWriteUntilFlush;
+}
+
+// Writes all dirty blocks back to the card files, with one flush per file.  Called from
+// the flush thread, and from Close.
+void FileMemoryCard::WriteBack()
+{
+	ScopedLock lock( m_mtx_file );
+
+	for( int slot=0; slot<8; ++slot )
+	{
+		wxFFile& mcfp( m_file[slot] );
+		if( !mcfp.IsOpened() ) continue;
+
+		std::vector<std::pair<u32, u32>> runs;		// file position and size
+		m_flushbuf.clear();
+
+		// Copy the dirty blocks while holding the image lock, so that the emulation
+		// thread isn't kept waiting on the disk.
+		{
+			ScopedLock imglock( m_mtx_image );
+			std::vector<u8>& dirty( m_dirty[slot] );
+
+			for( u32 block = 0; block < dirty.size(); ++block )
+			{
+				if( !dirty[block] ) continue;
+
+				const u32 pos = block * FlushBlockSize;
+				const u32 size = std::min<u32>( FlushBlockSize, m_image[slot].size() - pos );
+
+				if( !runs.empty() && runs.back().first + runs.back().second == pos )
+					runs.back().second += size;
+				else
+					runs.push_back( std::make_pair( pos, size ) );
+
+				m_flushbuf.insert( m_flushbuf.end(), &m_image[slot][pos], &m_image[slot][pos] + size );
+				dirty[block] = 0;
+			}
+		}
+
+		if( runs.empty() ) continue;
+
+		const u8* data = m_flushbuf.data();
+		for( const auto& run : runs )
+		{
+			if( !mcfp.Seek( run.first ) || mcfp.Write( data, run.second ) != run.second )
+				Console.Error( "(FileMcd) Failed to write back memory card data. (%d) [%08X]", slot, run.first );
+			data += run.second;
+		}
+
+		mcfp.Flush();
+	}
+}
+
+void FileMemoryCard::NextFrame( uint slot )
+{
+	if ( m_framesUntilFlush[slot] > 0 && --m_framesUntilFlush[slot] == 0 ) {
+		m_flushThread->Kick();
+	}
 }
 
 // returns FALSE if an error occurred (either permission denied or disk full)
@@ -293,7 +470,7 @@ void FileMemoryCard::GetSizeInfo( uint slot, PS2E_McdSizeInfo& outways )
 	outways.Xor						= 18;  // 0x12, XOR 02 00 00 10
 
 	if( pxAssert( m_file[slot].IsOpened() ) )
-		outways.McdSizeInSectors	= m_file[slot].Length() / (outways.SectorSize + outways.EraseBlockSizeInSectors);
+		outways.McdSizeInSectors	= m_image[slot].size() / (outways.SectorSize + outways.EraseBlockSizeInSectors);
 	else
 		outways.McdSizeInSectors	= 0x4000;
 
@@ -315,8 +492,9 @@ s32 FileMemoryCard::Read( uint slot, u8 *dest, u32 adr, int size )
 		memset(dest, 0, size);
 		return 1;
 	}
-	if( !Seek(mcfp, adr) ) return 0;
-	return mcfp.Read( dest, size ) != 0;
+	if( !InRange(slot, adr, size) ) return 0;
+	memcpy( dest, &m_image[slot][adr + m_offset[slot]], size );
+	return 1;
 }
 
 s32 FileMemoryCard::Save( uint slot, const u8 *src, u32 adr, int size )
@@ -336,10 +514,9 @@ s32 FileMemoryCard::Save( uint slot, const u8 *src, u32 adr, int size )
 	}
 	else
 	{
-		if( !Seek(mcfp, adr) ) return 0;
+		if( !InRange(slot, adr, size) ) return 0;
 		m_currentdata.MakeRoomFor( size );
-		mcfp.Read( m_currentdata.GetPtr(), size);
-		
+		memcpy( m_currentdata.GetPtr(), &m_image[slot][adr + m_offset[slot]], size );
 
 		for (int i=0; i<size; i++)
 		{
@@ -361,24 +538,21 @@ s32 FileMemoryCard::Save( uint slot, const u8 *src, u32 adr, int size )
 		}
 	}
 
-	if( !Seek(mcfp, adr) ) return 0;
+	if( !InRange(slot, adr, size) ) return 0;
 
-	int status = mcfp.Write( m_currentdata.GetPtr(), size );
+	WriteImage( slot, adr, m_currentdata.GetPtr(), size );
 
-	if( status ) {
-		static auto last = std::chrono::time_point<std::chrono::system_clock>();
+	static auto last = std::chrono::time_point<std::chrono::system_clock>();
 
-		std::chrono::duration<float> elapsed = std::chrono::system_clock::now() - last;
-		if(elapsed > std::chrono::seconds(5)) {
-			wxString name, ext;
-			wxFileName::SplitPath(m_file[slot].GetName(), NULL, NULL, &name, &ext);
-			OSDlog( Color_StrongYellow, false, "Memory Card %s written.", (const char *)(name + "." + ext).c_str() );
-			last = std::chrono::system_clock::now();
-		}
-		return 1;
+	std::chrono::duration<float> elapsed = std::chrono::system_clock::now() - last;
+	if(elapsed > std::chrono::seconds(5)) {
+		wxString name, ext;
+		wxFileName::SplitPath(m_file[slot].GetName(), NULL, NULL, &name, &ext);
+		OSDlog( Color_StrongYellow, false, "Memory Card %s written.", (const char *)(name + "." + ext).c_str() );
+		last = std::chrono::system_clock::now();
 	}
 
-	return 0;
+	return 1;
 }
 
 s32 FileMemoryCard::EraseBlock( uint slot, u32 adr )
@@ -391,8 +565,9 @@ s32 FileMemoryCard::EraseBlock( uint slot, u32 adr )
 		return 1;
 	}
 
-	if( !Seek(mcfp, adr) ) return 0;
-	return mcfp.Write( m_effeffs, sizeof(m_effeffs) ) != 0;
+	if( !InRange(slot, adr, sizeof(m_effeffs)) ) return 0;
+	WriteImage( slot, adr, m_effeffs, sizeof(m_effeffs) );
+	return 1;
 }
 
 u64 FileMemoryCard::GetCRC( uint slot )
@@ -404,16 +579,20 @@ u64 FileMemoryCard::GetCRC( uint slot )
 
 	if(m_ispsx[slot])
 	{
-		if( !Seek( mcfp, 0 ) ) return 0;
+		if( !InRange( slot, 0, 0 ) ) return 0;
 
 		// Process the file in 4k chunks.  Speeds things up significantly.
 	
 		u64 buffer[528*8];		// use 528 (sector size), ensures even divisibility
-	
-		const uint filesize = mcfp.Length() / sizeof(buffer);
-		for( uint i=filesize; i; --i )
+
+		const uint filesize = m_image[slot].size() / sizeof(buffer);
+		const u32 end = m_image[slot].size();
+		u32 pos = m_offset[slot];
+		for( uint i=filesize; i && pos < end; --i )
 		{
-			mcfp.Read( &buffer, sizeof(buffer) );
+			const u32 size = std::min<u32>( sizeof(buffer), end - pos );
+			memcpy( &buffer, &m_image[slot][pos], size );
+			pos += size;
 			for( uint t=0; t<ArraySize(buffer); ++t )
 				retval ^= buffer[t];
 		}
@@ -571,9 +750,9 @@ static u64 PS2E_CALLBACK FileMcd_GetCRC( PS2E_THISPTR thisptr, uint port, uint s
 static void PS2E_CALLBACK FileMcd_NextFrame( PS2E_THISPTR thisptr, uint port, uint slot ) {
 	const uint combinedSlot = FileMcd_ConvertToSlot( port, slot );
 	switch ( g_Conf->Mcd[combinedSlot].Type ) {
-	//case MemoryCardType::MemoryCard_File:
-	//	thisptr->impl.NextFrame( combinedSlot );
-	//	break;
+	case MemoryCardType::MemoryCard_File:
+		thisptr->impl.NextFrame( combinedSlot );
+		break;
 	case MemoryCardType::MemoryCard_Folder:
 		thisptr->implFolder.NextFrame( combinedSlot );
 		break;
@@ -430,17 +430,18 @@ bool FolderMemoryCard::AddFile( MemoryCardFileEntry* const dirEntry, const wxStr
 	wxFileName relativeFilePath( dirPath, fileName );
 	relativeFilePath.MakeRelativeTo( m_folderName.GetPath() );
 
+	// only the file size and times are needed to index the file, the data is read when the
+	// emulated software first accesses it (see ReadFromFile)
 	wxFileName fileInfo( dirPath, fileName );
-	wxFFile file( fileInfo.GetFullPath(), L"rb" );
-	if ( file.IsOpened() ) {
+	const wxULongLong fileSize = fileInfo.IsFileReadable() ? fileInfo.GetSize() : wxInvalidSize;
+	if ( fileSize != wxInvalidSize ) {
 		// make sure we have enough space on the memcard to hold the data
 		const u32 clusterSize = m_superBlock.data.pages_per_cluster * m_superBlock.data.page_len;
-		const u32 filesize = file.Length();
+		const u32 filesize = fileSize.GetLo();
 		const u32 countClusters = ( filesize % clusterSize ) != 0 ? ( filesize / clusterSize + 1 ) : ( filesize / clusterSize );
 		const u32 newNeededClusters = ( dirEntry->entry.data.length % 2 ) == 0 ? countClusters + 1 : countClusters;
 		if ( newNeededClusters > GetAmountFreeDataClusters() ) {
 			Console.Warning( GetCardFullMessage( relativeFilePath.GetFullPath() ) );
-			file.Close();
 			return false;
 		}
 
@@ -485,12 +486,10 @@ bool FolderMemoryCard::AddFile( MemoryCardFileEntry* const dirEntry, const wxStr
 			newFileEntry->entry.data.cluster = MemoryCardFileEntry::EmptyFileCluster;
 		}
 
-		file.Close();
-
 		MemoryCardFileMetadataReference* fileRef = AddFileEntryToMetadataQuickAccess( newFileEntry, parent );
 		if ( fileRef != nullptr ) {
-			// acquire a handle on the file so nothing else can change the file contents while the memory card is open
-			m_lastAccessedFile.ReOpen( m_folderName, fileRef );
+			// the file isn't kept open, so check on first access that it still is what was indexed
+			m_lastAccessedFile.SetIndexedFileSize( m_folderName, fileRef, filesize );
 		}
 
 		// and finally, increase file count in the directory entry
@@ -727,7 +726,7 @@ bool FolderMemoryCard::ReadFromFile( u8 *dest, u32 adr, u32 dataLength ) {
 	if ( it != m_fileMetadataQuickAccess.end() ) {
 		const u32 clusterNumber = it->second.consecutiveCluster;
 		wxFFile* file = m_lastAccessedFile.ReOpen( m_folderName, &it->second );
-		if ( file->IsOpened() ) {
+		if ( file != nullptr && file->IsOpened() ) {
 			const u32 clusterOffset = ( page % 2 ) * PageSize + offset;
 			const u32 fileOffset = clusterNumber * ClusterSize + clusterOffset;
 
@@ -1177,7 +1176,7 @@ bool FolderMemoryCard::WriteToFile( const u8* src, u32 adr, u32 dataLength ) {
 		
 		if ( m_performFileWrites ) {
 			wxFFile* file = m_lastAccessedFile.ReOpen( m_folderName, &it->second, true );
-			if ( file->IsOpened() ) {
+			if ( file != nullptr && file->IsOpened() ) {
 				const u32 clusterOffset = ( page % 2 ) * PageSize + offset;
 				const u32 fileSize = entry->entry.data.length;
 				const u32 fileOffsetStart = std::min( clusterNumber * ClusterSize + clusterOffset, fileSize );
@@ -1402,6 +1401,18 @@ wxFFile* FileAccessHelper::Open( const wxFileName& folderName, MemoryCardFileMet
 	bool cleanedFilename = fileRef->GetPath( &fn );
 	wxString filename( fn.GetFullPath() );
 
+	auto indexed = m_indexedFileSizes.find( filename );
+	if ( indexed != m_indexedFileSizes.end() ) {
+		// the FAT chain of this file was built from its size when the card was indexed, if it was
+		// removed or changed on the host since then don't touch it, creating an empty file here
+		// or reading data that doesn't match the chain would corrupt the save
+		if ( !fn.FileExists() || fn.GetSize() != wxULongLong( indexed->second ) ) {
+			Console.Error( L"(FolderMcd) File changed on the host while the memory card was open: %s", WX_STR( filename ) );
+			return nullptr;
+		}
+		m_indexedFileSizes.erase( indexed );
+	}
+
 	if ( !fn.FileExists() ) {
 		if ( !fn.DirExists() ) {
 			fn.Mkdir( 0777, wxPATH_MKDIR_FULL );
@@ -1506,10 +1517,23 @@ void FileAccessHelper::CloseFileHandle( wxFFile* file, const MemoryCardFileEntry
 	delete file;
 }
 
+void FileAccessHelper::SetIndexedFileSize( const wxFileName& folderName, MemoryCardFileMetadataReference* fileRef, u32 size ) {
+	wxFileName fn( folderName );
+	fileRef->GetPath( &fn );
+	m_indexedFileSizes[fn.GetFullPath()] = size;
+}
+
 void FileAccessHelper::CloseMatching( const wxString& path ) {
 	wxFileName fn( path );
 	fn.Normalize();
 	wxString pathNormalized = fn.GetFullPath();
+	for ( auto it = m_indexedFileSizes.begin(); it != m_indexedFileSizes.end(); ) {
+		if ( it->first.StartsWith( pathNormalized ) ) {
+			it = m_indexedFileSizes.erase( it );
+		} else {
+			++it;
+		}
+	}
 	for ( auto it = m_files.begin(); it != m_files.end(); ) {
 		wxString openPath = it->second.fileHandle->GetName();
 		if ( openPath.StartsWith( pathNormalized ) ) {
@@ -1526,6 +1550,7 @@ void FileAccessHelper::CloseAll() {
 		CloseFileHandle( it->second.fileHandle, it->second.fileRef->entry );
 	}
 	m_files.clear();
+	m_indexedFileSizes.clear();
 }
 
 void FileAccessHelper::FlushAll() {
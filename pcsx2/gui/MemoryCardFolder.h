@@ -215,6 +215,7 @@ class FileAccessHelper {
 protected:
 	std::map<std::string, MemoryCardFileHandleStructure> m_files;
 	MemoryCardFileMetadataReference* m_lastWrittenFileRef; // we remember this to reduce redundant metadata checks/writes
+	std::map<wxString, u32> m_indexedFileSizes; // host sizes of indexed files that haven't been opened yet
 
 public:
 	FileAccessHelper();
@@ -226,6 +227,8 @@ public:
 	void CloseMatching( const wxString& path );
 	// Close all open files
 	void CloseAll();
+	// Remember the size a file had when it was indexed, it has to match when the file is first opened
+	void SetIndexedFileSize( const wxFileName& folderName, MemoryCardFileMetadataReference* fileRef, u32 size );
 	// Flush the written data of all open files to the file system
 	void FlushAll();
 
@@ -240,7 +243,7 @@ protected:
 	// helper function for CleanMemcardFilename()
 	static bool CleanMemcardFilenameEndDotOrSpace( char* name, size_t length );
 
-	// Open a new file and remember it for later
+	// Open a new file and remember it for later, returns nullptr if an indexed file was changed or removed on the host
 	wxFFile* Open( const wxFileName& folderName, MemoryCardFileMetadataReference* fileRef, bool writeMetadata = false );
 	// Close a file and delete its handle
 	// If entry is given, it also attempts to set the created and modified timestamps of the file according to the entry
@@ -862,6 +862,16 @@ void psxSetBranchReg(u32 reg)
 {
 	psxbranch = 1;
 
+	// A jump through a register holding a known constant (lui/ori trampolines and the
+	// like) is really an immediate branch: link it to the target block directly instead
+	// of going back through the dispatcher.
+	if( reg != 0xffffffff && psxIsConstBranchTarget(reg) ) {
+		u32 newpc = g_psxConstRegs[reg];
+		psxRecompileNextInstruction(1);
+		psxSetBranchImm(newpc);
+		return;
+	}
+
 	if( reg != 0xffffffff ) {
 		_allocX86reg(calleeSavedReg2d, X86TYPE_PCWRITEBACK, 0, MODE_WRITE);
 		_psxMoveGPRtoR(calleeSavedReg2d, reg);
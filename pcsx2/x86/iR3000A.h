@@ -84,6 +84,13 @@ extern void psxRecompileNextInstruction(int delayslot);
 extern u32 g_psxConstRegs[32];
 extern u32 g_psxHasConstReg, g_psxFlushedConstReg;
 
+// Returns true when reg holds a compile-time constant that is a valid jump target,
+// so a register jump through it can be linked like an immediate branch.
+static __fi bool psxIsConstBranchTarget(int reg)
+{
+	return PSX_IS_CONST1(reg) && g_psxConstRegs[reg] && !(g_psxConstRegs[reg] & 3);
+}
+
 typedef void (*R3000AFNPTR)();
 typedef void (*R3000AFNPTR_INFO)(int info);
 
@@ -964,6 +964,22 @@ void rpsxJR()
 void rpsxJALR()
 {
 	// jalr Rs
+	if( psxIsConstBranchTarget(_Rs_) )
+	{
+		u32 newpc = g_psxConstRegs[_Rs_];
+
+		if ( _Rd_ )
+		{
+			_psxDeleteReg(_Rd_, 0);
+			PSX_SET_CONST(_Rd_);
+			g_psxConstRegs[_Rd_] = psxpc + 4;
+		}
+
+		psxRecompileNextInstruction(1);
+		psxSetBranchImm(newpc);
+		return;
+	}
+
 	_allocX86reg(calleeSavedReg2d, X86TYPE_PCWRITEBACK, 0, MODE_WRITE);
 	_psxMoveGPRtoR(calleeSavedReg2d, _Rs_);
 
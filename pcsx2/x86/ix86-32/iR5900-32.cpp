@@ -1190,6 +1190,24 @@ void __fastcall dynarecMemLogcheck(u32 start, bool store)
 
 void recMemcheck(u32 op, u32 bits, bool store)
 {
+	// Write checks on main ram may be handled by page protection instead (see mmap_CanWatchRange)
+	auto checks = CBreakPoints::GetMemChecks();
+	for (size_t i = 0; i < checks.size(); )
+	{
+		const MemCheck& check = checks[i];
+		bool skip = check.result == 0
+			|| ((check.cond & MEMCHECK_WRITE) == 0 && store)
+			|| ((check.cond & MEMCHECK_READ) == 0 && !store)
+			|| (store && mmap_CanWatchRange(check.start, check.end, check.cond));
+
+		if (skip)
+			checks.erase(checks.begin() + i);
+		else
+			i++;
+	}
+	if (checks.empty())
+		return;
+
 	iFlushCall(FLUSH_EVERYTHING|FLUSH_PC);
 
 	// compute accessed address
@@ -1207,16 +1225,8 @@ void recMemcheck(u32 op, u32 bits, bool store)
 	// ecx = access address
 	// edx = access address+size
 
-	auto checks = CBreakPoints::GetMemChecks();
 	for (size_t i = 0; i < checks.size(); i++)
 	{
-		if (checks[i].result == 0)
-			continue;
-		if ((checks[i].cond & MEMCHECK_WRITE) == 0 && store)
-			continue;
-		if ((checks[i].cond & MEMCHECK_READ) == 0 && !store)
-			continue;
-
 		// logic: memAddress < bpEnd && bpStart < memAddress+memSize
 
 		xMOV(eax,standardizeBreakpointAddress(checks[i].end));
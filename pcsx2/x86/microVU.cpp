@@ -163,6 +163,13 @@ __ri void mVUvsyncUpdate(mV) {
 
 // Deletes a program
 __ri void mVUdeleteProg(microVU& mVU, microProgram*& prog) {
+#ifdef mVUflagStats
+	if (prog->flagInsts) {
+		DevCon.WriteLn("microVU%d: Prog [%03d] [PC=%04x] Flag Instances = [%d/%d] eliminated (%3.1f%%)",
+			mVU.index, prog->idx, prog->startPC*8, prog->flagInsts - prog->flagInstsKept, prog->flagInsts,
+			(double)(prog->flagInsts - prog->flagInstsKept) / (double)prog->flagInsts * 100.0);
+	}
+#endif
 	for (u32 i = 0; i < (mVU.progSize / 2); i++) {
 		safe_delete(prog->block[i]);
 	}
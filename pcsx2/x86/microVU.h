@@ -16,6 +16,7 @@
 #pragma once
 //#define mVUlogProg // Dumps MicroPrograms to \logs\*.html
 //#define mVUprofileProg // Shows opcode statistics in console
+//#define mVUflagStats // Shows how many flag instances were optimized out per microProgram
 
 class AsciiFile;
 using namespace x86Emitter;
@@ -149,6 +150,10 @@ struct microProgram {
 	std::deque<microRange>* ranges;			   // The ranges of the microProgram that have already been recompiled
 	u32 startPC; // Start PC of this program
 	int idx;	 // Program index
+#ifdef mVUflagStats
+	u32 flagInsts;	   // Mac/non-sticky status flag instances written by the compiled blocks
+	u32 flagInstsKept; // Instances of the above that are still computed (live)
+#endif
 };
 
 typedef std::deque<microProgram*> microProgramList;
@@ -598,7 +598,13 @@ void* mVUcompile(microVU& mVU, u32 startPC, uptr pState) {
 	mVUregs.vi15  = (doConstProp && mVUconstReg[15].isValid) ? (u16)mVUconstReg[15].regValue : 0;
 	mVUregs.vi15v = (doConstProp && mVUconstReg[15].isValid) ? 1 : 0;
 
+#ifdef mVUflagStats
+	mVU.prog.cur->flagInsts     += mVUcountFlagInsts(mVU, false);
+#endif
 	mVUsetFlags(mVU, mFC);           // Sets Up Flag instances
+#ifdef mVUflagStats
+	mVU.prog.cur->flagInstsKept += mVUcountFlagInsts(mVU, true);
+#endif
 	mVUoptimizePipeState(mVU);       // Optimize the End Pipeline State for nicer Block Linking
 	mVUdebugPrintBlocks(mVU, false); // Prints Start/End PC of blocks executed, for debugging...
 	mVUtestCycles(mVU);              // Update VU Cycles and Exit Early if Necessary
@@ -253,6 +253,28 @@ __fi void mVUsetFlags(mV, microFlagCycles& mFC) {
 	}
 }
 
+#ifdef mVUflagStats
+// Counts the mac and non-sticky status flag instances of the current block.
+// Before mVUsetFlags() this is every instance the upper ops could write, after
+// it only the ones that are still computed (the rest weren't live in this block
+// or in any of its successors).
+u32 mVUcountFlagInsts(mV, bool computed) {
+	int endPC  = iPC;
+	u32 count  = 0;
+	iPC = mVUstartPC;
+	for(u32 i = 0; i < mVUcount; i++) {
+		if (computed) {
+			count += mFLAG.doFlag;
+			count += sFLAG.doFlag && sFLAG.doNonSticky;
+		}
+		else if (sFLAG.doFlag) count += 2;
+		incPC2(2);
+	}
+	iPC = endPC;
+	return count;
+}
+#endif
+
 #define getFlagReg2(x)	((bStatus[0] == x) ? getFlagReg(x) : gprT1)
 #define getFlagReg3(x)	((gFlag == x) ? gprT1 : getFlagReg(x))
 #define getFlagReg4(x)	((gFlag == x) ? gprT1 : gprT2)
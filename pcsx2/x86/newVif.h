@@ -66,6 +66,7 @@ struct nVifStruct {
 	u8*						recWritePtr;		// current write pos into the reserve
 
 	HashBucket				vifBlocks;		// Vif Blocks
+	u32						statsFrame;		// frame the vifBlocks statistics were last reported
 
 	nVifStruct() = default;
 };
@@ -21,6 +21,107 @@
 #include "newVif_UnpackSSE.h"
 #include "MTVU.h"
 #include "Utilities/Perf.h"
+#include "Counters.h"
+#include "AppConfig.h"
+
+// --------------------------------------------------------------------------------------
+//  Unpack routine cache
+// --------------------------------------------------------------------------------------
+// The set of unpack configurations used by games is small and mostly game-independent,
+// so the keys of every block compiled during a session are saved (in the settings folder)
+// and, when Recompiler.PrecompileVif is enabled, compiled up front on the next reset
+// instead of on first use in the middle of gameplay.
+
+struct nVifCacheKey {
+	u32 hash_key;
+	u32 key0;
+	u32 key1;
+};
+
+static const u32 nVifCacheMagic   = 0x31465643; // "CVF1"
+static const u32 nVifCacheMaxKeys = 4096;
+
+static wxString dVifCacheFilename(int idx) {
+	return GetSettingsFolder().Combine(wxsFormat(L"VIF%dUnpacks.cache", idx)).GetFullPath();
+}
+
+static void dVifSaveCache(int idx) {
+	const HashBucket& blocks = nVif[idx].vifBlocks;
+
+	if (!blocks.size())
+		return;
+
+	std::vector<nVifCacheKey> keys;
+	keys.reserve(blocks.size());
+
+	blocks.forEach([&keys](const nVifBlock& b) {
+		if (keys.size() < nVifCacheMaxKeys)
+			keys.push_back({b.hash_key, b.key0, b.key1});
+	});
+
+	wxFFile f(dVifCacheFilename(idx), L"wb");
+	if (!f.IsOpened())
+		return;
+
+	u32 header[2] = { nVifCacheMagic, (u32)keys.size() };
+	f.Write(header, sizeof(header));
+	f.Write(keys.data(), keys.size() * sizeof(nVifCacheKey));
+}
+
+static std::vector<nVifCacheKey> dVifLoadCache(int idx) {
+	std::vector<nVifCacheKey> keys;
+
+	wxString filename = dVifCacheFilename(idx);
+	if (!wxFileExists(filename))
+		return keys;
+
+	wxFFile f(filename, L"rb");
+	u32 header[2];
+
+	if (!f.IsOpened() || f.Read(header, sizeof(header)) != sizeof(header))
+		return keys;
+
+	if (header[0] != nVifCacheMagic || header[1] > nVifCacheMaxKeys)
+		return keys;
+
+	keys.resize(header[1]);
+
+	if (f.Read(keys.data(), keys.size() * sizeof(nVifCacheKey)) != keys.size() * sizeof(nVifCacheKey))
+		keys.clear();
+
+	return keys;
+}
+
+_vifT static nVifBlock* dVifCompile(nVifBlock& block, bool isFill);
+
+_vifT static void dVifPrecompile() {
+	nVifStruct& v = nVif[idx];
+
+	std::vector<nVifCacheKey> keys = dVifLoadCache(idx);
+
+	for (const nVifCacheKey& key : keys) {
+		// Leave plenty of room, the cache must not be reset from here
+		if (v.recWritePtr > (v.recReserve->GetPtrEnd() - _1mb))
+			break;
+
+		nVifBlock block;
+		memzero(block);
+		block.hash_key = key.hash_key;
+		block.key0     = key.key0;
+		block.key1     = key.key1;
+
+		if (v.vifBlocks.find(block))
+			continue;
+
+		const int wl = block.wl ? block.wl : 256;
+		dVifCompile<idx>(block, block.cl < wl);
+	}
+
+	v.vifBlocks.m_hits = v.vifBlocks.m_misses = v.vifBlocks.m_probes = 0;
+
+	if (!keys.empty())
+		DevCon.WriteLn("nVif%d: Precompiled %d unpack routines", idx, v.vifBlocks.size());
+}
 
 static void recReset(int idx) {
 	nVif[idx].vifBlocks.reset();
@@ -41,7 +142,14 @@ void dVifReserve(int idx) {
 void dVifReset(int idx) {
 	pxAssertDev(nVif[idx].recReserve, "Dynamic VIF recompiler reserve must be created prior to VIF use or reset!");
 
+	dVifSaveCache(idx);
+
 	recReset(idx);
+
+	if (EmuConfig.Cpu.Recompiler.PrecompileVif) {
+		if (idx) dVifPrecompile<1>();
+		else     dVifPrecompile<0>();
+	}
 }
 
 void dVifClose(int idx) {
@@ -50,6 +158,7 @@ void dVifClose(int idx) {
 }
 
 void dVifRelease(int idx) {
+	dVifSaveCache(idx);
 	dVifClose(idx);
 	safe_delete(nVif[idx].recReserve);
 }
@@ -273,7 +382,7 @@ static u16 dVifComputeLength(uint cl, uint wl, u8 num, bool isFill) {
 	return std::min(length, 0xFFFFu);
 }
 
-_vifT __fi nVifBlock* dVifCompile(nVifBlock& block, bool isFill) {
+_vifT static __fi nVifBlock* dVifCompile(nVifBlock& block, bool isFill) {
 	nVifStruct& v = nVif[idx];
 
 	// Check size before the compilation
@@ -289,14 +398,14 @@ _vifT __fi nVifBlock* dVifCompile(nVifBlock& block, bool isFill) {
 
 	block.startPtr = (uptr)xGetAlignedCallTarget();
 	block.length = dVifComputeLength(block.cl, block.wl, block.num, isFill);
-	v.vifBlocks.add(block);
+	nVifBlock* b = v.vifBlocks.add(block);
 
 	VifUnpackSSE_Dynarec(v, block).CompileRoutine();
 
 	Perf::vif.map((uptr)v.recWritePtr, xGetPtr() - v.recWritePtr, block.upkType /* FIXME ideally a key*/);
 	v.recWritePtr = xGetPtr();
 
-	return &block;
+	return b;
 }
 
 _vifT __fi void dVifUnpack(const u8* data, bool isFill) {
@@ -336,6 +445,14 @@ _vifT __fi void dVifUnpack(const u8* data, bool isFill) {
 	//	doMask >> 4, doMask ? wxsFormat( L"0x%08x", block.mask ).c_str() : L"ignored"
 	//);
 
+	// Report the lookup statistics of the previous frame
+	if (unlikely(v.statsFrame != g_FrameCount)) {
+		VIF_LOG("nVif%d: block cache %d hits, %d misses, %d extra probes (%d blocks)",
+			idx, v.vifBlocks.m_hits, v.vifBlocks.m_misses, v.vifBlocks.m_probes, v.vifBlocks.size());
+		v.vifBlocks.m_hits = v.vifBlocks.m_misses = v.vifBlocks.m_probes = 0;
+		v.statsFrame = g_FrameCount;
+	}
+
 	// Seach in cache before trying to compile the block
 	nVifBlock*  b = v.vifBlocks.find(block);
 	if (unlikely(b == nullptr)) {
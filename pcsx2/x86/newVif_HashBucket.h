@@ -15,10 +15,8 @@
 
 #pragma once
 
-#include <array>
-
-// nVifBlock - Ordered for Hashing; the 'num' and 'upkType' fields are
-//             used as the hash bucket selector.
+// nVifBlock - the 'num' and 'upkType' fields (hash_key) along with key0 and
+//             key1 form the lookup key of a block.
 union nVifBlock {
 	// Warning: order depends on the newVifDynaRec code
 	struct {
@@ -43,92 +41,132 @@ union nVifBlock {
 
 }; // 16 bytes
 
-// 0x4000 is enough but 0x10000 allow
-// * to skip the compare value of the first double world in lookup
-// * to use a 16 bits move instead of an 'and' mask to compute the hashed key
-#define hSize 0x10000 // [usn*1:mask*1:upk*4:num*8] hash...
-
-// HashBucket is a container which uses a built-in hash function
-// to perform quick searches. It is designed around the nVifBlock structure
-//
-// The hash function is determined by taking the first bytes of data and
-// performing a modulus the size of hSize. So the most diverse-data should
-// be in the first bytes of the struct. (hence why nVifBlock is specifically sorted)
+// HashBucket is an open-addressing hash table (linear probing) designed around
+// the nVifBlock structure. The whole key (hash_key/key0/key1) is mixed into the
+// hash, so blocks that only differ by their mask or cycle/mode fields no longer
+// pile up in the same chain. The table lives in a single 64B aligned allocation
+// and is doubled (and rehashed) when it gets 3/4 full, which only happens a
+// handful of times per session. A free cell is marked by a null startPtr.
 class HashBucket {
 protected:
-	std::array<nVifBlock*, hSize> m_bucket;
+	static const u32 InitialSize = 0x1000;
+
+	nVifBlock* m_table;
+	u32 m_mask;		// table size - 1 (size is a power of 2)
+	u32 m_count;	// number of blocks stored
 
 public:
-	HashBucket() {
-		m_bucket.fill(nullptr);
+	// Lookup statistics, reset by whoever reports them (see dVifUnpack)
+	u32 m_hits;
+	u32 m_misses;
+	u32 m_probes;	// extra cells visited on top of the first one
+
+	HashBucket()
+		: m_table(nullptr), m_mask(0), m_count(0)
+		, m_hits(0), m_misses(0), m_probes(0)
+	{
 	}
 
 	~HashBucket() { clear(); }
 
+	static __fi u32 hash(const nVifBlock& dataPtr) {
+		u32 h = dataPtr.hash_key * 0x9E3779B1u;
+		h ^= dataPtr.key0 * 0x85EBCA77u;
+		h ^= dataPtr.key1 * 0xC2B2AE3Du;
+		h ^= h >> 15;
+		h *= 0x2C1B3C6Du;
+		h ^= h >> 13;
+		return h;
+	}
+
 	__fi nVifBlock* find(const nVifBlock& dataPtr) {
-		nVifBlock* chainpos = m_bucket[dataPtr.hash_key];
+		u32 i = hash(dataPtr) & m_mask;
 
 		while (true) {
-			if (chainpos->key0 == dataPtr.key0 && chainpos->key1 == dataPtr.key1)
-				return chainpos;
+			nVifBlock* cell = &m_table[i];
 
-			if (chainpos->startPtr == 0)
+			if (cell->startPtr == 0) {
+				m_misses++;
 				return nullptr;
+			}
+
+			if (cell->hash_key == dataPtr.hash_key && cell->key0 == dataPtr.key0 && cell->key1 == dataPtr.key1) {
+				m_hits++;
+				return cell;
+			}
 
-			chainpos++;
+			m_probes++;
+			i = (i + 1) & m_mask;
 		}
 	}
 
-	void add(const nVifBlock& dataPtr) {
-		u32 b = dataPtr.hash_key;
-
-		u32 size = bucket_size( dataPtr );
+	// Returns the stored copy of the block
+	nVifBlock* add(const nVifBlock& dataPtr) {
+		if ((m_count + 1) * 4 > (m_mask + 1) * 3)
+			resize((m_mask + 1) * 2);
 
-		// Warning there is an extra +1 due to the empty cell
-		// Performance note: 64B align to reduce cache miss penalty in `find`
-		if( (m_bucket[b] = (nVifBlock*)pcsx2_aligned_realloc( m_bucket[b], sizeof(nVifBlock)*(size+2), 64, sizeof(nVifBlock)*(size+1) )) == NULL ) {
-			throw Exception::OutOfMemory(
-				wxsFormat(L"HashBucket Chain (bucket size=%d)", size+2)
-			);
-		}
+		m_count++;
+		return insert(dataPtr);
+	}
 
-		// Replace the empty cell by the new block and create a new empty cell
-		memcpy(&m_bucket[b][size++], &dataPtr, sizeof(nVifBlock));
-		memset(&m_bucket[b][size], 0, sizeof(nVifBlock));
+	u32 size() const { return m_count; }
 
-		if( size > 3 ) DevCon.Warning( "recVifUnpk: Bucket 0x%04x has %d micro-programs", b, size );
+	template< typename Fn >
+	void forEach(Fn fn) const {
+		for (u32 i = 0; m_table && i <= m_mask; i++) {
+			if (m_table[i].startPtr != 0)
+				fn(m_table[i]);
+		}
 	}
 
-	u32 bucket_size(const nVifBlock& dataPtr) {
-		nVifBlock* chainpos = m_bucket[dataPtr.hash_key];
+	void clear() {
+		safe_aligned_free(m_table);
+		m_mask = 0;
+		m_count = 0;
+	}
 
-		u32 size = 0;
+	void reset() {
+		clear();
+		alloc(InitialSize);
+		m_hits = m_misses = m_probes = 0;
+	}
 
-		while (chainpos->startPtr != 0) {
-			size++;
-			chainpos++;
+protected:
+	void alloc(u32 size) {
+		// Performance note: 64B align to reduce cache miss penalty in `find`
+		if ((m_table = (nVifBlock*)_aligned_malloc(sizeof(nVifBlock) * size, 64)) == nullptr) {
+			throw Exception::OutOfMemory(
+				wxsFormat(L"HashBucket table (size=%d)", size)
+			);
 		}
 
-		return size;
+		memset(m_table, 0, sizeof(nVifBlock) * size);
+		m_mask = size - 1;
 	}
 
-	void clear() {
-		for (auto& bucket : m_bucket)
-			safe_aligned_free(bucket);
+	nVifBlock* insert(const nVifBlock& dataPtr) {
+		u32 i = hash(dataPtr) & m_mask;
+
+		while (m_table[i].startPtr != 0)
+			i = (i + 1) & m_mask;
+
+		memcpy(&m_table[i], &dataPtr, sizeof(nVifBlock));
+		return &m_table[i];
 	}
 
-	void reset() {
-		clear();
+	void resize(u32 size) {
+		nVifBlock* old = m_table;
+		u32 oldSize = m_mask + 1;
 
-		// Allocate an empty cell for all buckets
-		for (auto& bucket : m_bucket) {
-			if( (bucket = (nVifBlock*)_aligned_malloc( sizeof(nVifBlock), 64 )) == nullptr ) {
-				throw Exception::OutOfMemory(
-						wxsFormat(L"HashBucket Chain (bucket size=%d)", 1)
-						);
-			}
+		alloc(size);
 
-			memset(bucket, 0, sizeof(nVifBlock));
+		for (u32 i = 0; i < oldSize; i++) {
+			if (old[i].startPtr != 0)
+				insert(old[i]);
 		}
+
+		safe_aligned_free(old);
+
+		DevCon.WriteLn("recVifUnpk: Block cache grown to %d entries (%d micro-programs)", size, m_count);
 	}
 };
@@ -1051,6 +1051,11 @@ EXPORT_C GSReplay(HWND hwnd, HINSTANCE hinst, LPSTR lpszCmdLine, int nCmdShow)
 
 	file->Read(regs.data(), 0x2000);
 
+	// Optionally replay frames [replay_start_frame, replay_end_frame] only, from the last keyframe before them
+	uint32 start_frame = theApp.GetConfigI("replay_start_frame");
+	uint32 end_frame = theApp.GetConfigI("replay_end_frame");
+	uint32 frame = file->SeekKeyFrame(start_frame);
+
 	GSvsync(1);
 
 	struct Packet {uint8 type, param; uint32 size, addr; std::vector<uint8> buff;};
@@ -1087,21 +1092,57 @@ EXPORT_C GSReplay(HWND hwnd, HINSTANCE hinst, LPSTR lpszCmdLine, int nCmdShow)
 			p.buff.resize(0x2000);
 			file->Read(p.buff.data(), 0x2000);
 			break;
+		case 4:
+			file->Read(&p.addr, 4);
+			file->Read(&p.size, 4);
+			p.buff.resize(p.size + 0x2000);
+			file->Read(p.buff.data(), p.size + 0x2000);
+			break;
 		}
 
 		return p;
 	};
 
 	std::list<Packet> packets;
+	Packet keyframe = {};
 	uint8 type;
 	while(file->Read(&type, 1))
-		packets.push_back(read_packet(type));
+	{
+		Packet p = read_packet(type);
+
+		if(p.type == 4)
+		{
+			// the state of this keyframe replaces everything read so far
+			if(p.addr <= start_frame)
+			{
+				keyframe = std::move(p);
+				frame = keyframe.addr;
+				packets.clear();
+			}
+
+			continue;
+		}
+
+		packets.push_back(std::move(p));
+
+		if(type == 1 && ++frame >= end_frame && end_frame > 0)
+			break;
+	}
 
 	Sleep(100);
 
 	std::vector<uint8> buff;
 	while(IsWindowVisible(hWnd))
 	{
+		if(keyframe.type == 4)
+		{
+			GSFreezeData fd;
+			fd.size = keyframe.size;
+			fd.data = keyframe.buff.data();
+			GSfreeze(FREEZE_LOAD, &fd);
+			memcpy(regs.data(), &keyframe.buff[keyframe.size], 0x2000);
+		}
+
 		for(auto &p : packets)
 		{
 			switch(p.type)
@@ -1371,6 +1412,7 @@ EXPORT_C GSReplay(char* lpszCmdLine, int renderer)
 	struct Packet {uint8 type, param; uint32 size, addr; std::vector<uint8> buff;};
 
 	std::list<Packet*> packets;
+	Packet* keyframe = nullptr;
 	std::vector<uint8> buff;
 	uint8 regs[0x2000];
 
@@ -1421,6 +1463,11 @@ EXPORT_C GSReplay(char* lpszCmdLine, int renderer)
 
 		file->Read(regs, 0x2000);
 
+		// Optionally replay frames [replay_start_frame, replay_end_frame] only, from the last keyframe before them
+		uint32 start_frame = repack_dump ? 0 : theApp.GetConfigI("replay_start_frame");
+		uint32 end_frame = repack_dump ? 0 : theApp.GetConfigI("replay_end_frame");
+		frame_number = file->SeekKeyFrame(start_frame);
+
 		uint8 type;
 		while(file->Read(&type, 1))
 		{
@@ -1467,13 +1514,47 @@ EXPORT_C GSReplay(char* lpszCmdLine, int renderer)
 
 				file->Read(&p->buff[0], 0x2000);
 
+				break;
+
+			case 4:
+				file->Read(&p->addr, 4);
+				file->Read(&p->size, 4);
+				p->buff.resize(p->size + 0x2000);
+
+				file->Read(&p->buff[0], p->size + 0x2000);
+
 				break;
 			}
 
+			if (type == 4)
+			{
+				// the state of this keyframe replaces everything read so far
+				if (p->addr <= start_frame)
+				{
+					for (auto i : packets)
+						delete i;
+
+					packets.clear();
+
+					delete keyframe;
+					keyframe = p;
+					frame_number = p->addr;
+				}
+				else
+				{
+					delete p;
+				}
+
+				continue;
+			}
+
 			packets.push_back(p);
 
 			if (repack_dump && frame_number > -finished)
 				break;
+
+			if (end_frame > 0 && frame_number >= end_frame)
+				break;
 		}
 
 		delete file;
@@ -1489,6 +1570,15 @@ EXPORT_C GSReplay(char* lpszCmdLine, int renderer)
 
 	while(finished > 0)
 	{
+		if (keyframe)
+		{
+			GSFreezeData fd;
+			fd.size = keyframe->size;
+			fd.data = &keyframe->buff[0];
+			GSfreeze(FREEZE_LOAD, &fd);
+			memcpy(regs, &keyframe->buff[keyframe->size], 0x2000);
+		}
+
 		for(auto i = packets.begin(); i != packets.end(); i++)
 		{
 			Packet* p = *i;
@@ -1541,6 +1631,23 @@ EXPORT_C GSReplay(char* lpszCmdLine, int renderer)
 
 	static_cast<GSDeviceOGL*>(s_gs->m_dev)->GenerateProfilerData();
 
+	// the per draw cost of the gs thread, the vertex preparation part of it and the rasterizer workers
+
+	GSPerfMon& pm = s_gs->m_perfmon;
+
+	double draws = std::max<double>(pm.GetTotal(GSPerfMon::Draw), 1);
+
+	uint64 worker_ticks = 0;
+
+	for(int i = 0; i < pm.GetWorkerCount(); i++)
+	{
+		worker_ticks += pm.GetTicks(GSPerfMon::WorkerDraw + i);
+	}
+
+	fprintf(stderr, "%.0f draws, %.0f prims. Ticks per draw: %.0f gs thread, %.0f vertex preparation, %.0f workers\n",
+		pm.GetTotal(GSPerfMon::Draw), pm.GetTotal(GSPerfMon::Prim),
+		pm.GetTicks(GSPerfMon::Main) / draws, pm.GetTicks(GSPerfMon::Prepare) / draws, worker_ticks / draws);
+
 #ifdef ENABLE_OGL_DEBUG_MEM_BW
 	unsigned long total_frame_nb = std::max(1l, frame_number) << 10;
 	fprintf(stderr, "memory bandwith. T: %f KB/f. V: %f KB/f. U: %f KB/f\n",
@@ -1557,6 +1664,8 @@ EXPORT_C GSReplay(char* lpszCmdLine, int renderer)
 
 	packets.clear();
 
+	delete keyframe;
+
 	sleep(2);
 
 	GSclose();
@@ -332,6 +332,53 @@ public:
 
 		// TODO: pshufb
 
+		#if _M_SSE >= 0x501
+
+		// same steps as below, with rows 0/1 and 2/3 in the two halves of v0 and v1
+
+		GSVector4i v4 = GSVector4i::load<alignment != 0>(&src[srcpitch * 0]);
+		GSVector4i v5 = GSVector4i::load<alignment != 0>(&src[srcpitch * 1]);
+		GSVector4i v6 = GSVector4i::load<alignment != 0>(&src[srcpitch * 2]);
+		GSVector4i v7 = GSVector4i::load<alignment != 0>(&src[srcpitch * 3]);
+
+		GSVector8i v0(v4, v5);
+		GSVector8i v1(v6, v7);
+
+		if((i & 1) == 0)
+		{
+			v1 = v1.yxwzlh();
+		}
+		else
+		{
+			v0 = v0.yxwzlh();
+		}
+
+		const __m256i epi32_0f0f0f0f = _mm256_set1_epi32(0x0f0f0f0f);
+
+		GSVector8i mask(epi32_0f0f0f0f);
+
+		GSVector8i v2 = (v1 << 4).blend(v0, mask);
+		GSVector8i v3 = v1.blend(v0 >> 4, mask);
+
+		v0 = v2.upl8(v3);
+		v1 = v2.uph8(v3);
+
+		GSVector8i::sw8(v0, v1);
+		GSVector8i::sw8(v0, v1);
+
+		v2 = v0.ac(v1);
+		v3 = v0.bd(v1);
+
+		v0 = v2.upl64(v3);
+		v1 = v2.uph64(v3);
+
+		GSVector8i::storel(&dst[(i * 4 + 0) * 16], v0);
+		GSVector8i::storel(&dst[(i * 4 + 1) * 16], v1);
+		GSVector8i::storeh(&dst[(i * 4 + 2) * 16], v0);
+		GSVector8i::storeh(&dst[(i * 4 + 3) * 16], v1);
+
+		#else
+
 		GSVector4i v0 = GSVector4i::load<alignment != 0>(&src[srcpitch * 0]);
 		GSVector4i v1 = GSVector4i::load<alignment != 0>(&src[srcpitch * 1]);
 		GSVector4i v2 = GSVector4i::load<alignment != 0>(&src[srcpitch * 2]);
@@ -357,6 +404,8 @@ public:
 		((GSVector4i*)dst)[i * 4 + 1] = v1;
 		((GSVector4i*)dst)[i * 4 + 2] = v2;
 		((GSVector4i*)dst)[i * 4 + 3] = v3;
+
+		#endif
 	}
 
 	template<int alignment, uint32 mask> static void WriteColumn32(int y, uint8* RESTRICT dst, const uint8* RESTRICT src, int srcpitch)
@@ -556,29 +605,41 @@ public:
 	{
 		//for(int j = 0; j < 64; j++) ((uint8*)src)[j] = (uint8)j;
 
-		#if 0//_M_SSE >= 0x501
+		#if _M_SSE >= 0x501
+
+		// same steps as the ssse3 path, with v0/v2 and v1/v3 of it in the two halves of v0 and v1
 
 		const GSVector8i* s = (const GSVector8i*)src;
-		
-		GSVector8i v0 = s[i * 2 + 0];
-		GSVector8i v1 = s[i * 2 + 1];
 
-		GSVector8i::sw8(v0, v1);
-		GSVector8i::sw16(v0, v1);
-		GSVector8i::sw8(v0, v1);
-		GSVector8i::sw128(v0, v1);
+		GSVector8i v0, v1;
+
+		if((i & 1) == 0)
+		{
+			v0 = s[i * 2 + 0].ac(s[i * 2 + 1]);
+			v1 = s[i * 2 + 0].bd(s[i * 2 + 1]);
+		}
+		else
+		{
+			v0 = s[i * 2 + 1].ac(s[i * 2 + 0]);
+			v1 = s[i * 2 + 1].bd(s[i * 2 + 0]);
+		}
+
+		GSVector8i mask = GSVector8i::broadcast128(m_r8mask);
+
+		v0 = v0.shuffle8(mask);
+		v1 = v1.shuffle8(mask);
+
 		GSVector8i::sw16(v0, v1);
 
-		v0 = v0.acbd();
-		v1 = v1.acbd();
-		v1 = v1.yxwz();
+		GSVector8i v2 = v0.ad(v1);
+		GSVector8i v3 = v0.bc(v1);
 
-		GSVector8i::storel(&dst[dstpitch * 0], v0);
-		GSVector8i::storeh(&dst[dstpitch * 1], v0);
-		GSVector8i::storel(&dst[dstpitch * 2], v1);
-		GSVector8i::storeh(&dst[dstpitch * 3], v1);
+		GSVector8i::sw32(v2, v3);
 
-		// TODO: not sure if this is worth it, not in this form, there should be a shorter path
+		GSVector8i::storel(&dst[dstpitch * 0], v2);
+		GSVector8i::storel(&dst[dstpitch * 1], v3);
+		GSVector8i::storeh(&dst[dstpitch * 2], v2);
+		GSVector8i::storeh(&dst[dstpitch * 3], v3);
 
 		#elif _M_SSE >= 0x301
 
@@ -651,7 +712,54 @@ public:
 	{
 		//printf("ReadColumn4\n");
 
-		#if _M_SSE >= 0x301
+		#if _M_SSE >= 0x501
+
+		// same steps as the ssse3 path, two of its vectors in each of v0 and v1
+
+		const GSVector8i* s = (const GSVector8i*)src;
+
+		GSVector8i v0 = s[i * 2 + 0].ac(s[i * 2 + 1]).xzyw();
+		GSVector8i v1 = s[i * 2 + 0].bd(s[i * 2 + 1]).xzyw();
+
+		GSVector8i::sw64(v0, v1);
+
+		const __m256i epi32_0f0f0f0f = _mm256_set1_epi32(0x0f0f0f0f);
+
+		GSVector8i mask(epi32_0f0f0f0f);
+
+		GSVector8i v2 = (v1 << 4).blend(v0, mask);
+		GSVector8i v3 = v1.blend(v0 >> 4, mask);
+
+		v0 = v2.upl8(v3);
+		v1 = v2.uph8(v3);
+
+		GSVector8i::sw8(v0, v1);
+
+		mask = GSVector8i::broadcast128(m_r4mask);
+
+		v0 = v0.shuffle8(mask);
+		v1 = v1.shuffle8(mask);
+
+		v2 = v0.ac(v1);
+		v3 = v0.bd(v1);
+
+		if((i & 1) == 0)
+		{
+			v0 = v2.upl16(v3);
+			v1 = v3.uph16(v2);
+		}
+		else
+		{
+			v0 = v3.upl16(v2);
+			v1 = v2.uph16(v3);
+		}
+
+		GSVector8i::storel(&dst[dstpitch * 0], v0);
+		GSVector8i::storeh(&dst[dstpitch * 1], v0);
+		GSVector8i::storel(&dst[dstpitch * 2], v1);
+		GSVector8i::storeh(&dst[dstpitch * 3], v1);
+
+		#elif _M_SSE >= 0x301
 
 		const GSVector4i* s = (const GSVector4i*)src;
 
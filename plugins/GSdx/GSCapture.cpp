@@ -388,6 +388,85 @@ static IPin* GetFirstPin(IBaseFilter* pBF, PIN_DIRECTION dir)
 // GSCapture
 //
 
+#if defined(__unix__)
+
+GSCapture::StreamFrame::StreamFrame(const uint8* image, int w, int h, int pitch, bool rgba)
+	: m_pitch(w * 4), m_rgba(rgba)
+{
+	m_image = (uint8*)_aligned_malloc(m_pitch * h, 32);
+
+	if(m_image)
+	{
+		for(int j = 0; j < h; j++)
+		{
+			memcpy(&m_image[j * m_pitch], &image[j * pitch], m_pitch);
+		}
+	}
+}
+
+GSCapture::StreamFrame::~StreamFrame()
+{
+	if(m_image)
+	{
+		_aligned_free(m_image);
+	}
+}
+
+void GSCapture::WriteStreamFrame(std::shared_ptr<StreamFrame>& frame)
+{
+	if(m_stream_error)
+	{
+		return;
+	}
+
+	const int w = m_size.x;
+	const int h = m_size.y;
+
+	// A repeated frame reuses the planes converted last time
+
+	if(frame != m_stream_yuv_src)
+	{
+		m_stream_yuv.resize(w * h * 3);
+
+		uint8* RESTRICT y = &m_stream_yuv[0];
+		uint8* RESTRICT u = y + w * h;
+		uint8* RESTRICT v = u + w * h;
+
+		const int ri = frame->m_rgba ? 0 : 2;
+		const int bi = frame->m_rgba ? 2 : 0;
+
+		for(int j = 0; j < h; j++)
+		{
+			const uint8* RESTRICT src = &frame->m_image[j * frame->m_pitch];
+
+			for(int i = 0; i < w; i++, src += 4)
+			{
+				// BT.601 studio range, same coefficients as the YUY2 output of GSSource
+
+				int r = src[ri];
+				int g = src[1];
+				int b = src[bi];
+
+				*y++ = (uint8)(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+				*u++ = (uint8)(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+				*v++ = (uint8)(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+			}
+		}
+
+		m_stream_yuv_src = frame;
+	}
+
+	if(fputs("FRAME\n", m_stream_fp) == EOF
+	|| fwrite(m_stream_yuv.data(), 1, m_stream_yuv.size(), m_stream_fp) != m_stream_yuv.size())
+	{
+		fprintf(stderr, "GSdx: failed to write capture frame: %s\n", strerror(errno));
+
+		m_stream_error = true;
+	}
+}
+
+#endif
+
 GSCapture::GSCapture()
 	: m_capturing(false), m_frame(0)
 	  , m_out_dir("/tmp/GSdx_Capture") // FIXME Later add an option
@@ -396,6 +475,9 @@ GSCapture::GSCapture()
 	m_threads = theApp.GetConfigI("capture_threads");
 #if defined(__unix__)
 	m_compression_level = theApp.GetConfigI("png_compression_level");
+	m_stream = false;
+	m_stream_fp = NULL;
+	m_stream_error = false;
 #endif
 }
 
@@ -498,8 +580,60 @@ bool GSCapture::BeginCapture(float fps, GSVector2i recommendedResolution, float
 	m_size.x = theApp.GetConfigI("CaptureWidth");
 	m_size.y = theApp.GetConfigI("CaptureHeight");
 
-	for(int i = 0; i < m_threads; i++) {
-		m_workers.push_back(std::unique_ptr<GSPng::Worker>(new GSPng::Worker(&GSPng::Process)));
+	m_stream = theApp.GetConfigB("capture_stream");
+
+	if(m_stream)
+	{
+		// A single 4:4:4 Y4M stream, the file can also be a fifo read by an encoder (ffmpeg -i fifo -c:v ffv1 ...)
+
+		// Named after the start time like the snapshots, never overwrite an earlier capture
+
+		char local_time[16] = "";
+		time_t cur_time = time(nullptr);
+
+		strftime(local_time, sizeof(local_time), "%Y%m%d%H%M%S", localtime(&cur_time));
+
+		std::string out_file = m_out_dir + format("/capture_%s.y4m", local_time);
+
+		for(int n = 2; FILE* fp = px_fopen(out_file, "rb"); n++)
+		{
+			fclose(fp);
+
+			out_file = m_out_dir + format("/capture_%s_(%d).y4m", local_time, n);
+		}
+
+		m_stream_fp = px_fopen(out_file, "wb");
+
+		if(m_stream_fp == NULL)
+		{
+			fprintf(stderr, "GSdx: failed to open %s\n", out_file.c_str());
+
+			return false;
+		}
+
+		if(fprintf(m_stream_fp, "YUV4MPEG2 W%d H%d F%d:1000 Ip A1:1 C444\n", m_size.x, m_size.y, (int)(fps * 1000 + 0.5f)) < 0)
+		{
+			fprintf(stderr, "GSdx: failed to write %s\n", out_file.c_str());
+
+			fclose(m_stream_fp);
+
+			m_stream_fp = NULL;
+
+			return false;
+		}
+
+		printf("GSdx: capturing to %s\n", out_file.c_str());
+
+		m_stream_error = false;
+
+		m_stream_worker = std::unique_ptr<StreamWorker>(new StreamWorker(
+			[this](std::shared_ptr<StreamFrame>& frame) { WriteStreamFrame(frame); }));
+	}
+	else
+	{
+		for(int i = 0; i < m_threads; i++) {
+			m_workers.push_back(std::unique_ptr<GSPng::Worker>(new GSPng::Worker(&GSPng::Process)));
+		}
 	}
 #endif
 
@@ -530,6 +664,47 @@ bool GSCapture::DeliverFrame(const void* bits, int pitch, bool rgba)
 
 #elif defined(__unix__)
 
+	if(m_stream)
+	{
+		const uint8* src = static_cast<const uint8*>(bits);
+
+		bool same = m_stream_last && m_stream_last->m_image && m_stream_last->m_rgba == rgba;
+
+		for(int j = 0; same && j < m_size.y; j++)
+		{
+			same = memcmp(&m_stream_last->m_image[j * m_stream_last->m_pitch], &src[j * pitch], m_size.x * 4) == 0;
+		}
+
+		if(!same)
+		{
+			m_stream_last = std::make_shared<StreamFrame>(src, m_size.x, m_size.y, pitch, rgba);
+
+			if(m_stream_last->m_image == NULL)
+			{
+				fprintf(stderr, "GSdx: out of memory for a capture frame, capture stopped\n");
+
+				EndCapture();
+
+				return false;
+			}
+		}
+
+		if(m_stream_error)
+		{
+			fprintf(stderr, "GSdx: capture stopped after a failed write\n");
+
+			EndCapture();
+
+			return false;
+		}
+
+		m_stream_worker->Push(m_stream_last);
+
+		m_frame++;
+
+		return true;
+	}
+
 	std::string out_file = m_out_dir + format("/frame.%010d.png", m_frame);
 	//GSPng::Save(GSPng::RGB_PNG, out_file, (uint8*)bits, m_size.x, m_size.y, pitch, m_compression_level);
 	m_workers[m_frame%m_threads]->Push(std::make_shared<GSPng::Transaction>(GSPng::RGB_PNG, out_file, static_cast<const uint8*>(bits), m_size.x, m_size.y, pitch, m_compression_level));
@@ -564,6 +739,19 @@ bool GSCapture::EndCapture()
 #elif defined(__unix__)
 	m_workers.clear();
 
+	m_stream_worker.reset(); // drains the queue
+
+	m_stream_last = NULL;
+	m_stream_yuv_src = NULL;
+	m_stream_yuv.clear();
+
+	if(m_stream_fp)
+	{
+		fclose(m_stream_fp);
+
+		m_stream_fp = NULL;
+	}
+
 	m_frame = 0;
 
 #endif
@@ -44,9 +44,32 @@ class GSCapture
 
 	#elif defined(__unix__)
 
+	class StreamFrame
+	{
+	public:
+		uint8* m_image;
+		int m_pitch;
+		bool m_rgba;
+
+		StreamFrame(const uint8* image, int w, int h, int pitch, bool rgba);
+		~StreamFrame();
+	};
+
+	using StreamWorker = GSJobQueue<std::shared_ptr<StreamFrame>, 16>;
+
 	std::vector<std::unique_ptr<GSPng::Worker>> m_workers;
 	int m_compression_level;
 
+	bool m_stream;
+	FILE* m_stream_fp;
+	std::unique_ptr<StreamWorker> m_stream_worker;
+	std::shared_ptr<StreamFrame> m_stream_last; // last frame queued, identical frames are queued again instead of copied
+	std::shared_ptr<StreamFrame> m_stream_yuv_src; // owned by the stream worker
+	std::vector<uint8> m_stream_yuv; // owned by the stream worker
+	std::atomic<bool> m_stream_error; // set by the stream worker on a failed write
+
+	void WriteStreamFrame(std::shared_ptr<StreamFrame>& frame);
+
 	#endif
 
 public:
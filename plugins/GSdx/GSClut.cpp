@@ -23,7 +23,7 @@
 #include "GSClut.h"
 #include "GSLocalMemory.h"
 
-#define CLUT_ALLOC_SIZE (2 * 4096)
+#define CLUT_ALLOC_SIZE 4096
 
 GSClut::GSClut(GSLocalMemory* mem)
 	: m_mem(mem)
@@ -31,10 +31,22 @@ GSClut::GSClut(GSLocalMemory* mem)
 	uint8* p = (uint8*)vmalloc(CLUT_ALLOC_SIZE, false);
 
 	m_clut = (uint16*)&p[0]; // 1k + 1k for mirrored area simulating wrapping memory
-	m_buff32 = (uint32*)&p[2048]; // 1k
-	m_buff64 = (uint64*)&p[4096]; // 2k
+
+	m_cache = (ReadEntry*)_aligned_malloc(sizeof(ReadEntry) * ReadCacheSize, 32);
+	m_cache_used = 0;
+
+	for(int i = 0; i < ReadCacheSize; i++)
+	{
+		m_cache[i].size = 0;
+		m_cache[i].used = 0;
+		m_cache[i].adirty = true;
+	}
+
+	m_buff32 = m_cache[0].buff32; // 1k, points to the entry of the last Read32
+	m_buff64 = m_cache[0].buff64; // 2k
 	m_write.dirty = true;
 	m_read.dirty = true;
+	m_read.entry = &m_cache[0];
 
 	for(int i = 0; i < 16; i++)
 	{
@@ -91,6 +103,8 @@ GSClut::GSClut(GSLocalMemory* mem)
 GSClut::~GSClut()
 {
 	vmfree(m_clut, CLUT_ALLOC_SIZE);
+
+	_aligned_free(m_cache);
 }
 
 void GSClut::Invalidate()
@@ -293,7 +307,6 @@ void GSClut::Read32(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA)
 		m_read.TEX0 = TEX0;
 		m_read.TEXA = TEXA;
 		m_read.dirty = false;
-		m_read.adirty = true;
 
 		uint16* clut = m_clut;
 
@@ -304,12 +317,14 @@ void GSClut::Read32(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA)
 			case PSM_PSMT8:
 			case PSM_PSMT8H:
 				clut += (TEX0.CSA & 15) << 4; // disney golf title screen
+				if(LookupReadEntry(TEX0, TEXA, clut, 512, true)) break;
 				ReadCLUT_T32_I8(clut, m_buff32);
 				break;
 			case PSM_PSMT4:
 			case PSM_PSMT4HL:
 			case PSM_PSMT4HH:
 				clut += (TEX0.CSA & 15) << 4;
+				if(LookupReadEntry(TEX0, TEXA, clut, 32, true)) break;
 				// TODO: merge these functions
 				ReadCLUT_T32_I4(clut, m_buff32);
 				ExpandCLUT64_T32_I8(m_buff32, (uint64*)m_buff64); // sw renderer does not need m_buff64 anymore
@@ -323,12 +338,14 @@ void GSClut::Read32(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA)
 			case PSM_PSMT8:
 			case PSM_PSMT8H:
 				clut += TEX0.CSA << 4;
+				if(LookupReadEntry(TEX0, TEXA, clut, 512, false)) break;
 				Expand16(clut, m_buff32, 256, TEXA);
 				break;
 			case PSM_PSMT4:
 			case PSM_PSMT4HL:
 			case PSM_PSMT4HH:
 				clut += TEX0.CSA << 4;
+				if(LookupReadEntry(TEX0, TEXA, clut, 32, false)) break;
 				// TODO: merge these functions
 				Expand16(clut, m_buff32, 16, TEXA);
 				ExpandCLUT64_T32_I8(m_buff32, (uint64*)m_buff64); // sw renderer does not need m_buff64 anymore
@@ -338,20 +355,108 @@ void GSClut::Read32(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA)
 	}
 }
 
+bool GSClut::LookupReadEntry(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, const uint16* RESTRICT clut, int size, bool hi)
+{
+	// size bytes of colors at clut, for 32-bit palettes the upper halves follow 512 bytes later
+
+	const GSVector4i* s0 = (const GSVector4i*)clut;
+	const GSVector4i* s1 = (const GSVector4i*)(clut + 256);
+
+	int n = size >> 4;
+
+	GSVector4i h = GSVector4i::zero();
+
+	for(int i = 0; i < n; i++)
+	{
+		h = (h.sll32(5) + h) ^ s0[i];
+	}
+
+	if(hi)
+	{
+		for(int i = 0; i < n; i++)
+		{
+			h = (h.sll32(5) + h) ^ s1[i];
+		}
+
+		size *= 2;
+	}
+
+	h = h ^ h.zwxy();
+	h = h ^ h.yxwz();
+
+	uint32 hash = (uint32)h.extract32<0>();
+	uint32 key = TEX0.PSM | (TEX0.CPSM << 8) | (TEX0.CSA << 16);
+
+	ReadEntry* e = &m_cache[0];
+
+	for(int i = 0; i < ReadCacheSize; i++)
+	{
+		ReadEntry* c = &m_cache[i];
+
+		if(c->size == (uint32)size && c->hash == hash && c->key == key && c->TEXA.u64 == TEXA.u64)
+		{
+			if(hi ? GSVector4i::compare16(c->src, clut, size / 2) && GSVector4i::compare16(&c->src[size / 4], clut + 256, size / 2) : GSVector4i::compare16(c->src, clut, size))
+			{
+				c->used = ++m_cache_used;
+
+				m_read.entry = c;
+
+				m_buff32 = c->buff32;
+				m_buff64 = c->buff64;
+
+				return true;
+			}
+		}
+
+		if(c->used < e->used)
+		{
+			e = c;
+		}
+	}
+
+	// evict the least recently used one, the caller fills in its buffers
+
+	if(hi)
+	{
+		memcpy(e->src, clut, size / 2);
+		memcpy(&e->src[size / 4], clut + 256, size / 2);
+	}
+	else
+	{
+		memcpy(e->src, clut, size);
+	}
+
+	e->size = size;
+	e->hash = hash;
+	e->key = key;
+	e->TEXA = TEXA;
+	e->used = ++m_cache_used;
+	e->adirty = true;
+
+	m_read.entry = e;
+
+	m_buff32 = e->buff32;
+	m_buff64 = e->buff64;
+
+	return false;
+}
+
 void GSClut::GetAlphaMinMax32(int& amin_out, int& amax_out)
 {
 	// call only after Read32
 
 	ASSERT(!m_read.dirty);
 
-	if(m_read.adirty)
+	ReadEntry* e = m_read.entry;
+
+	if(e->adirty)
 	{
-		m_read.adirty = false;
+		e->adirty = false;
 
 		if(GSLocalMemory::m_psm[m_read.TEX0.CPSM].trbpp == 24 && m_read.TEXA.AEM == 0)
 		{
-			m_read.amin = m_read.TEXA.TA0;
-			m_read.amax = m_read.TEXA.TA0;
+			e->amin = m_read.TEXA.TA0;
+			e->amax = m_read.TEXA.TA0;
 		}
 		else
 		{
@@ -396,13 +501,13 @@ void GSClut::GetAlphaMinMax32(int& amin_out, int& amax_out)
 			GSVector4i v0 = amin.upl8(amax).u8to16();
 			GSVector4i v1 = v0.yxwz();
 
-			m_read.amin = v0.min_i16(v1).extract16<0>();
-			m_read.amax = v0.max_i16(v1).extract16<1>();
+			e->amin = v0.min_i16(v1).extract16<0>();
+			e->amax = v0.max_i16(v1).extract16<1>();
 		}
 	}
 
-	amin_out = m_read.amin;
-	amax_out = m_read.amax;
+	amin_out = e->amin;
+	amax_out = e->amax;
 }
 
 //
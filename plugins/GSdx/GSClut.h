@@ -49,17 +49,39 @@ class alignas(32) GSClut : public GSAlignedClass<32>
 		bool IsDirty(const GIFRegTEX0& TEX0, const GIFRegTEXCLUT& TEXCLUT);
 	} m_write;
 
+	// expanded palettes of the last few CLUT contents read, games often switch between a handful of them every frame
+
+	struct alignas(32) ReadEntry
+	{
+		uint32 buff32[256];
+		uint64 buff64[256];
+		uint16 src[512]; // the CLUT data it was expanded from
+		uint32 size; // of src in bytes, 0 if unused
+		uint32 hash;
+		uint32 key; // PSM, CPSM, CSA
+		GIFRegTEXA TEXA;
+		uint32 used;
+		bool adirty;
+		int amin, amax;
+	};
+
+	enum {ReadCacheSize = 8};
+
+	ReadEntry* m_cache;
+	uint32 m_cache_used;
+
 	struct alignas(32) ReadState
 	{
 		GIFRegTEX0 TEX0;
 		GIFRegTEXA TEXA;
 		bool dirty;
-		bool adirty;
-		int amin, amax;
+		ReadEntry* entry;
 		bool IsDirty(const GIFRegTEX0& TEX0);
 		bool IsDirty(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA);
 	} m_read;
 
+	bool LookupReadEntry(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, const uint16* RESTRICT clut, int size, bool hi);
+
 	typedef void (GSClut::*writeCLUT)(const GIFRegTEX0& TEX0, const GIFRegTEXCLUT& TEXCLUT);
 
 	writeCLUT m_wc[2][16][64];
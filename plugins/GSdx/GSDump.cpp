@@ -25,6 +25,7 @@
 GSDumpBase::GSDumpBase(const std::string& fn)
 	: m_frames(0)
 	, m_extra_frames(2)
+	, m_keyframe_interval(theApp.GetConfigI("dump_keyframe_interval"))
 {
 	m_gs = px_fopen(fn, "wb");
 	if (!m_gs)
@@ -83,6 +84,22 @@ bool GSDumpBase::VSync(int field, bool last, const GSPrivRegSet* regs)
 	return (++m_frames & 1) == 0 && last && (m_extra_frames < 0);
 }
 
+bool GSDumpBase::IsKeyFrameDue() const
+{
+	return m_gs && m_keyframe_interval > 0 && m_frames % m_keyframe_interval == 0;
+}
+
+void GSDumpBase::KeyFrame(const GSFreezeData& fd, const GSPrivRegSet* regs)
+{
+	BeginKeyFrame();
+
+	AppendRawData(4);
+	AppendRawData(&m_frames, 4);
+	AppendRawData(&fd.size, 4);
+	AppendRawData(fd.data, fd.size);
+	AppendRawData(regs, sizeof(*regs));
+}
+
 void GSDumpBase::Write(const void *data, size_t size)
 {
 	if (!m_gs || size == 0)
@@ -119,76 +136,130 @@ void GSDump::AppendRawData(uint8 c)
 
 GSDumpXz::GSDumpXz(const std::string& fn, uint32 crc, const GSFreezeData& fd, const GSPrivRegSet* regs)
 	: GSDumpBase(fn + ".gs.xz")
+	, m_out_buff(1024*1024)
 {
 	m_strm = LZMA_STREAM_INIT;
-	lzma_ret ret = lzma_easy_encoder(&m_strm, 6 /*level*/, LZMA_CHECK_CRC64);
-	if (ret != LZMA_OK) {
-		fprintf(stderr, "GSDumpXz: Error initializing LZMA encoder ! (error code %u)\n", ret);
+
+	if (!InitEncoder())
 		return;
-	}
+
+	m_compressor = std::unique_ptr<GSJobQueue<std::shared_ptr<std::vector<uint8>>, 8>>(new GSJobQueue<std::shared_ptr<std::vector<uint8>>, 8>(
+		[this](std::shared_ptr<std::vector<uint8>>& buff) { Compress(buff); }));
 
 	AddHeader(crc, fd, regs);
 }
 
 GSDumpXz::~GSDumpXz()
 {
-	Flush();
+	if (m_compressor) {
+		Flush();
 
-	// Finish the stream
-	m_strm.avail_in = 0;
-	Compress(LZMA_FINISH, LZMA_STREAM_END);
+		// Drain the queue before finishing the stream from this thread
+		m_compressor.reset();
+
+		m_strm.avail_in = 0;
+		Compress(LZMA_FINISH, LZMA_STREAM_END);
+	}
 
 	lzma_end(&m_strm);
 }
 
+bool GSDumpXz::InitEncoder()
+{
+	lzma_mt mt = {};
+	// Each encoder thread costs tens of MB at preset 6 (dictionary plus block buffers),
+	// a few threads are enough to keep up with the dump rate.
+	mt.threads = std::min<uint32>(std::max<uint32>(lzma_cputhreads(), 1), 4);
+	mt.preset = 6; // level
+	mt.check = LZMA_CHECK_CRC64;
+
+	lzma_ret ret = lzma_stream_encoder_mt(&m_strm, &mt);
+	if (ret != LZMA_OK) {
+		fprintf(stderr, "GSDumpXz: Error initializing LZMA encoder ! (error code %u)\n", ret);
+		return false;
+	}
+
+	return true;
+}
+
 void GSDumpXz::AppendRawData(const void *data, size_t size)
 {
+	// Nothing would ever drain the buffer without an encoder
+	if (!m_compressor)
+		return;
+
 	size_t old_size = m_in_buff.size();
 	m_in_buff.resize(old_size + size);
 	memcpy(&m_in_buff[old_size], data, size);
 
-	// Enough data was accumulated, time to write/compress it.  If compression
-	// is enabled, it will freeze PCSX2. 1GB should be enough for long dump.
-	//
-	// Note: long dumps are currently not supported so this path won't be executed
-	if (m_in_buff.size() > 1024*1024*1024)
+	// Enough data was accumulated, hand it over to the compression thread
+	if (m_in_buff.size() >= 4*1024*1024)
 		Flush();
 }
 
 void GSDumpXz::AppendRawData(uint8 c)
 {
+	if (!m_compressor)
+		return;
+
 	m_in_buff.push_back(c);
 }
 
 void GSDumpXz::Flush()
 {
-	if (m_in_buff.empty())
+	if (m_in_buff.empty() || !m_compressor)
 		return;
 
-	m_strm.next_in = m_in_buff.data();
-	m_strm.avail_in = m_in_buff.size();
+	auto buff = std::make_shared<std::vector<uint8>>();
+	buff->swap(m_in_buff);
 
-	Compress(LZMA_RUN, LZMA_OK);
+	m_compressor->Push(buff);
+}
+
+void GSDumpXz::BeginKeyFrame()
+{
+	if (!m_compressor)
+		return;
 
-	m_in_buff.clear();
+	Flush();
+
+	// An empty buffer ends the current xz stream
+	m_compressor->Push(nullptr);
+}
+
+void GSDumpXz::Compress(std::shared_ptr<std::vector<uint8>>& buff)
+{
+	if (!buff) {
+		m_strm.avail_in = 0;
+		Compress(LZMA_FINISH, LZMA_STREAM_END);
+		InitEncoder();
+		return;
+	}
+
+	m_strm.next_in = buff->data();
+	m_strm.avail_in = buff->size();
+
+	Compress(LZMA_RUN, LZMA_OK);
 }
 
 void GSDumpXz::Compress(lzma_action action, lzma_ret expected_status)
 {
-	std::vector<uint8> out_buff(1024*1024);
+	lzma_ret ret;
+
 	do {
-		m_strm.next_out = out_buff.data();
-		m_strm.avail_out = out_buff.size();
+		m_strm.next_out = m_out_buff.data();
+		m_strm.avail_out = m_out_buff.size();
 
-		lzma_ret ret = lzma_code(&m_strm, action);
+		ret = lzma_code(&m_strm, action);
 
-		if (ret != expected_status) {
+		// LZMA_OK only means the output buffer was filled before the stream could end
+		if (ret != expected_status && ret != LZMA_OK) {
 			fprintf (stderr, "GSDumpXz: Error %d\n", (int) ret);
 			return;
 		}
 
-		size_t write_size = out_buff.size() - m_strm.avail_out;
-		Write(out_buff.data(), write_size);
+		size_t write_size = m_out_buff.size() - m_strm.avail_out;
+		Write(m_out_buff.data(), write_size);
 
-	} while (m_strm.avail_out == 0);
+	} while (m_strm.avail_out == 0 || m_strm.avail_in > 0 || ret != expected_status);
 }
@@ -22,6 +22,7 @@
 #pragma once
 
 #include "GS.h"
+#include "GSThread_CXX11.h"
 #include "Renderers/SW/GSVertexSW.h"
 #include <lzma.h>
 
@@ -42,12 +43,20 @@ ReadFIFO2 data (id == 2)
 Regs data (id == 3)
 - [PMODE/0x2000]
 
+KeyFrame data (id == 4)
+- [4/1] [frame/4] [state size/4] [state data/size] [PMODE/0x2000]
+
+A keyframe is the state after the given number of VSync packets, the replayer can start from
+there instead of the header. In xz dumps every keyframe also starts a new xz stream, so the
+stream indexes double as a seek table and a keyframe can be decompressed without what precedes it.
+
 */
 
 class GSDumpBase
 {
 	int m_frames;
 	int m_extra_frames;
+	int m_keyframe_interval;
 	FILE* m_gs;
 
 protected:
@@ -56,6 +65,7 @@ protected:
 
 	virtual void AppendRawData(const void *data, size_t size) = 0;
 	virtual void AppendRawData(uint8 c) = 0;
+	virtual void BeginKeyFrame() {}
 
 public:
 	GSDumpBase(const std::string& fn);
@@ -64,6 +74,8 @@ public:
 	void ReadFIFO(uint32 size);
 	void Transfer(int index, const uint8* mem, size_t size);
 	bool VSync(int field, bool last, const GSPrivRegSet* regs);
+	bool IsKeyFrameDue() const;
+	void KeyFrame(const GSFreezeData& fd, const GSPrivRegSet* regs);
 };
 
 class GSDump final : public GSDumpBase
@@ -81,11 +93,18 @@ class GSDumpXz final : public GSDumpBase
 	lzma_stream m_strm;
 
 	std::vector<uint8> m_in_buff;
+	std::vector<uint8> m_out_buff;
+
+	// filled buffers are compressed in the background, the GS thread only blocks when the queue is full
+	std::unique_ptr<GSJobQueue<std::shared_ptr<std::vector<uint8>>, 8>> m_compressor;
 
+	bool InitEncoder();
 	void Flush();
+	void Compress(std::shared_ptr<std::vector<uint8>>& buff);
 	void Compress(lzma_action action, lzma_ret expected_status);
 	void AppendRawData(const void *data, size_t size);
 	void AppendRawData(uint8 c);
+	void BeginKeyFrame();
 
 public:
 	GSDumpXz(const std::string& fn, uint32 crc, const GSFreezeData& fd, const GSPrivRegSet* regs);
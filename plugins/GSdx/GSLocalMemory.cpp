@@ -501,6 +501,50 @@ GSLocalMemory::~GSLocalMemory()
 	{
 		delete [] i.second;
 	}
+
+	SetHelperThreads(0);
+}
+
+void GSLocalMemory::SetHelperThreads(int threads)
+{
+	for(auto helper : m_helpers) delete helper;
+
+	m_helpers.clear();
+
+	// the jobs are bound by memory bandwidth, a few helpers are enough to saturate it
+
+	threads = std::min<int>(threads, 3);
+
+	for(int i = 0; i < threads; i++)
+	{
+		m_helpers.push_back(new GSJobQueue<HelperJob, 16>([](HelperJob& job)
+		{
+			job.run(job.param, job.begin, job.end);
+		}));
+	}
+}
+
+void GSLocalMemory::RunHelpers(void (*run)(const void* param, int begin, int end), const void* param, int count, int n)
+{
+	ASSERT(n >= 1 && n <= (int)m_helpers.size() + 1);
+
+	int begin = 0;
+
+	for(int i = 0; i < n - 1; i++)
+	{
+		int end = (int)((int64)count * (i + 1) / n);
+
+		m_helpers[i]->Push({run, param, begin, end});
+
+		begin = end;
+	}
+
+	run(param, begin, count);
+
+	for(int i = 0; i < n - 1; i++)
+	{
+		m_helpers[i]->Wait();
+	}
 }
 
 GSOffset* GSLocalMemory::GetOffset(uint32 bp, uint32 bw, uint32 psm)
@@ -772,6 +816,45 @@ void GSLocalMemory::WriteImageBlock(int l, int r, int y, int h, const uint8* src
 	}
 }
 
+void GSLocalMemory::WriteImageBlocks(writeImageBlock wb, int bsy, int l, int r, int y, int h, const uint8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF)
+{
+	// waking up the workers costs more than swizzling a few pages
+
+	int rows = h / bsy;
+	int n = std::min<int>(m_helpers.size() + 1, rows);
+
+	if(n < 2 || srcpitch * h < 64 * 1024)
+	{
+		(this->*wb)(l, r, y, h, src, srcpitch, BITBLTBUF);
+
+		return;
+	}
+
+	// the caller has already synced the pages with the renderer (InvalidateVideoMem), and
+	// every range is written before returning, so nobody else can observe a partial upload
+
+	struct SwizzleJob
+	{
+		GSLocalMemory* mem;
+		writeImageBlock wb;
+		int bsy, l, r, y;
+		const uint8* src;
+		int srcpitch;
+		GIFRegBITBLTBUF BITBLTBUF;
+	};
+
+	SwizzleJob job = {this, wb, bsy, l, r, y, src, srcpitch, BITBLTBUF};
+
+	// the ranges are in block rows
+
+	RunHelpers([](const void* param, int begin, int end)
+	{
+		const SwizzleJob& job = *(const SwizzleJob*)param;
+
+		(job.mem->*job.wb)(job.l, job.r, job.y + begin * job.bsy, (end - begin) * job.bsy, job.src + job.srcpitch * begin * job.bsy, job.srcpitch, job.BITBLTBUF);
+	}, &job, rows, n);
+}
+
 template<int psm, int bsx, int bsy>
 void GSLocalMemory::WriteImageLeftRight(int l, int r, int y, int h, const uint8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF)
 {
@@ -1030,15 +1113,15 @@ void GSLocalMemory::WriteImage(int& tx, int& ty, const uint8* src, int len, GIFR
 
 					if((addr & 31) == 0 && (srcpitch & 31) == 0)
 					{
-						WriteImageBlock<psm, bsx, bsy, 32>(la, ra, ty, h2, s, srcpitch, BITBLTBUF);
+						WriteImageBlocks(&GSLocalMemory::WriteImageBlock<psm, bsx, bsy, 32>, bsy, la, ra, ty, h2, s, srcpitch, BITBLTBUF);
 					}
 					else if((addr & 15) == 0 && (srcpitch & 15) == 0)
 					{
-						WriteImageBlock<psm, bsx, bsy, 16>(la, ra, ty, h2, s, srcpitch, BITBLTBUF);
+						WriteImageBlocks(&GSLocalMemory::WriteImageBlock<psm, bsx, bsy, 16>, bsy, la, ra, ty, h2, s, srcpitch, BITBLTBUF);
 					}
 					else
 					{
-						WriteImageBlock<psm, bsx, bsy, 0>(la, ra, ty, h2, s, srcpitch, BITBLTBUF);
+						WriteImageBlocks(&GSLocalMemory::WriteImageBlock<psm, bsx, bsy, 0>, bsy, la, ra, ty, h2, s, srcpitch, BITBLTBUF);
 					}
 
 					s += srcpitch * h2;
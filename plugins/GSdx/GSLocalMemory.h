@@ -26,6 +26,7 @@
 #include "GSVector.h"
 #include "GSBlock.h"
 #include "GSClut.h"
+#include "GSThread_CXX11.h"
 
 class GSOffset : public GSAlignedClass<32>
 {
@@ -178,10 +179,32 @@ protected:
 	std::unordered_map<uint32, GSPixelOffset4*> m_po4map;
 	std::unordered_map<uint64, std::vector<GSVector2i>*> m_p2tmap;
 
+	// helper threads for the memory bound work of the GS thread, large IMAGE transfers and SW texture
+	// conversion, they are never needed at the same time so a single pool serves both
+
+	struct HelperJob
+	{
+		void (*run)(const void* param, int begin, int end);
+		const void* param;
+		int begin, end;
+	};
+
+	std::vector<GSJobQueue<HelperJob, 16>*> m_helpers;
+
+	typedef void (GSLocalMemory::*writeImageBlock)(int l, int r, int y, int h, const uint8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF);
+
+	void WriteImageBlocks(writeImageBlock wb, int bsy, int l, int r, int y, int h, const uint8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF);
+
 public:
 	GSLocalMemory();
 	virtual ~GSLocalMemory();
 
+	void SetHelperThreads(int threads);
+	int GetHelperThreads() const {return (int)m_helpers.size();}
+
+	// splits [0, count) into n ranges, n - 1 are run on the helpers and the last one on the calling thread, returns when all are done
+	void RunHelpers(void (*run)(const void* param, int begin, int end), const void* param, int count, int n);
+
 	GSOffset* GetOffset(uint32 bp, uint32 bw, uint32 psm);
 	GSPixelOffset* GetPixelOffset(const GIFRegFRAME& FRAME, const GIFRegZBUF& ZBUF);
 	GSPixelOffset4* GetPixelOffset4(const GIFRegFRAME& FRAME, const GIFRegZBUF& ZBUF);
@@ -53,21 +53,52 @@ GSDumpFile::~GSDumpFile() {
 		fclose(m_repack_fp);
 }
 
+static int fseek64(FILE* fp, int64 offset, int origin) {
+#ifdef _WIN32
+	return _fseeki64(fp, offset, origin);
+#else
+	return fseeko(fp, offset, origin);
+#endif
+}
+
+static int64 ftell64(FILE* fp) {
+#ifdef _WIN32
+	return _ftelli64(fp);
+#else
+	return ftello(fp);
+#endif
+}
+
 /******************************************************************/
 GSDumpLzma::GSDumpLzma(char* filename, const char* repack_filename) : GSDumpFile(filename, repack_filename) {
 
 	memset(&m_strm, 0, sizeof(lzma_stream));
 
-	lzma_ret ret = lzma_stream_decoder(&m_strm, UINT32_MAX, 0);
+	m_buff_size = 1024*1024;
+	m_area      = (uint8_t*)_aligned_malloc(m_buff_size, 32);
+	m_inbuf     = (uint8_t*)_aligned_malloc(BUFSIZ, 32);
+
+	// A repacked dump must be read from start to end
+	if (repack_filename == nullptr)
+		BuildIndex();
+
+	Seek(0);
+}
+
+void GSDumpLzma::Seek(int64 offset) {
+	if (fseek64(m_fp, offset, SEEK_SET) != 0) {
+		fprintf(stderr, "Seek error: %s\n", strerror(errno));
+		throw "BAD"; // Just exit the program
+	}
+
+	// Keyframes start new xz streams, keep going through all of them
+	lzma_ret ret = lzma_stream_decoder(&m_strm, UINT32_MAX, LZMA_CONCATENATED);
 
 	if (ret != LZMA_OK) {
 		fprintf(stderr, "Error initializing the decoder! (error code %u)\n", ret);
 		throw "BAD"; // Just exit the program
 	}
 
-	m_buff_size = 1024*1024;
-	m_area      = (uint8_t*)_aligned_malloc(m_buff_size, 32);
-	m_inbuf     = (uint8_t*)_aligned_malloc(BUFSIZ, 32);
 	m_avail     = 0;
 	m_start     = 0;
 
@@ -78,6 +109,92 @@ GSDumpLzma::GSDumpLzma(char* filename, const char* repack_filename) : GSDumpFile
 	m_strm.next_out  = m_area;
 }
 
+void GSDumpLzma::BuildIndex() {
+	// Walk the xz streams backward from the end of the file, each one ends with
+	// a footer giving the size of its index, and the index gives the size of the stream
+	std::vector<int64> streams;
+	std::vector<uint8_t> index_buff;
+
+	if (fseek64(m_fp, 0, SEEK_END) != 0)
+		return;
+
+	int64 pos = ftell64(m_fp);
+
+	while (pos > 0) {
+		uint8_t footer[LZMA_STREAM_HEADER_SIZE];
+		lzma_stream_flags flags;
+
+		if (pos < 2 * LZMA_STREAM_HEADER_SIZE
+			|| fseek64(m_fp, pos - LZMA_STREAM_HEADER_SIZE, SEEK_SET) != 0
+			|| fread(footer, 1, sizeof(footer), m_fp) != sizeof(footer)
+			|| lzma_stream_footer_decode(&flags, footer) != LZMA_OK)
+			break;
+
+		int64 index_pos = pos - LZMA_STREAM_HEADER_SIZE - (int64)flags.backward_size;
+
+		if (index_pos < LZMA_STREAM_HEADER_SIZE)
+			break;
+
+		index_buff.resize(flags.backward_size);
+
+		if (fseek64(m_fp, index_pos, SEEK_SET) != 0 || fread(index_buff.data(), 1, index_buff.size(), m_fp) != index_buff.size())
+			break;
+
+		lzma_index* index = nullptr;
+		uint64_t memlimit = UINT64_MAX;
+		size_t in_pos = 0;
+
+		if (lzma_index_buffer_decode(&index, &memlimit, nullptr, index_buff.data(), &in_pos, index_buff.size()) != LZMA_OK)
+			break;
+
+		pos -= (int64)lzma_index_file_size(index);
+
+		lzma_index_end(index, nullptr);
+
+		streams.push_back(pos);
+	}
+
+	clearerr(m_fp);
+
+	// Truncated or padded file, stay sequential
+	if (pos != 0)
+		return;
+
+	// Every stream but the first should start with a keyframe packet
+	for (auto i = streams.rbegin(); i != streams.rend(); i++) {
+		if (*i == 0)
+			continue;
+
+		Seek(*i);
+
+		while (m_avail == 0 && !IsEof())
+			Decompress();
+
+		if (m_avail >= 5 && m_area[0] == 4) {
+			KeyFrame kf;
+			kf.offset = *i;
+			memcpy(&kf.frame, &m_area[1], 4);
+			m_keyframes.push_back(kf);
+		}
+	}
+}
+
+uint32 GSDumpLzma::SeekKeyFrame(uint32 frame) {
+	const KeyFrame* kf = nullptr;
+
+	for (const auto& k : m_keyframes) {
+		if (k.frame <= frame)
+			kf = &k;
+	}
+
+	if (kf == nullptr)
+		return 0;
+
+	Seek(kf->offset);
+
+	return kf->frame;
+}
+
 void GSDumpLzma::Decompress() {
 	lzma_action action = LZMA_RUN;
 
@@ -95,6 +212,10 @@ void GSDumpLzma::Decompress() {
 		}
 	}
 
+	// No more streams will follow
+	if (feof(m_fp))
+		action = LZMA_FINISH;
+
 	lzma_ret ret = lzma_code(&m_strm, action);
 
 	if (ret != LZMA_OK) {
@@ -32,6 +32,10 @@ class GSDumpFile {
 	virtual bool IsEof() = 0;
 	virtual bool Read(void* ptr, size_t size) = 0;
 
+	// Moves to the last indexed keyframe at or before frame and returns its frame,
+	// returns 0 and keeps reading sequentially when there is none
+	virtual uint32 SeekKeyFrame(uint32 frame) { return 0; }
+
 	GSDumpFile(char* filename, const char* repack_filename);
 	virtual ~GSDumpFile();
 };
@@ -47,7 +51,13 @@ class GSDumpLzma : public GSDumpFile {
 	size_t		m_avail;
 	size_t		m_start;
 
+	struct KeyFrame {uint32 frame; int64 offset;};
+
+	std::vector<KeyFrame> m_keyframes;
+
 	void Decompress();
+	void Seek(int64 offset);
+	void BuildIndex();
 
 	public:
 
@@ -56,6 +66,7 @@ class GSDumpLzma : public GSDumpFile {
 
 	bool IsEof() final;
 	bool Read(void* ptr, size_t size) final;
+	uint32 SeekKeyFrame(uint32 frame) final;
 };
 
 class GSDumpRaw : public GSDumpFile {
@@ -23,14 +23,44 @@
 #include "GSPerfMon.h"
 
 GSPerfMon::GSPerfMon()
-	: m_frame(0)
+	: m_timers(NULL)
+	, m_timer_count(0)
+	, m_frametime_count(0)
+	, m_frame(0)
 	, m_lastframe(0)
 	, m_count(0)
 {
 	memset(m_counters, 0, sizeof(m_counters));
 	memset(m_stats, 0, sizeof(m_stats));
-	memset(m_total, 0, sizeof(m_total));
-	memset(m_begin, 0, sizeof(m_begin));
+	memset(m_totals, 0, sizeof(m_totals));
+	memset(m_frametimes, 0, sizeof(m_frametimes));
+
+	SetWorkerCount(0);
+}
+
+GSPerfMon::~GSPerfMon()
+{
+	_aligned_free(m_timers);
+}
+
+void GSPerfMon::SetWorkerCount(int count)
+{
+	_aligned_free(m_timers);
+
+	m_timer_count = WorkerDraw + std::max<int>(count, 0);
+	m_timers = (Timer*)_aligned_malloc(sizeof(Timer) * m_timer_count, alignof(Timer));
+
+	uint64 now = __rdtsc();
+
+	for(int i = 0; i < m_timer_count; i++)
+	{
+		Timer* t = new (&m_timers[i]) Timer();
+
+		t->start = 0;
+		t->total = 0;
+		t->last_total = 0;
+		t->last_time = now;
+	}
 }
 
 void GSPerfMon::Put(counter_t c, double val)
@@ -50,7 +80,11 @@ void GSPerfMon::Put(counter_t c, double val)
 
 		if(m_lastframe != 0)
 		{
-			m_counters[c] += (now - m_lastframe) * 1000 / CLOCKS_PER_SEC;
+			double ms = (double)(now - m_lastframe) * 1000 / CLOCKS_PER_SEC;
+
+			m_counters[c] += ms;
+			m_totals[c] += ms;
+			m_frametimes[m_frametime_count++ & (FrameTimeCount - 1)] = (float)ms;
 		}
 
 		m_lastframe = now;
@@ -60,10 +94,31 @@ void GSPerfMon::Put(counter_t c, double val)
 	else
 	{
 		m_counters[c] += val;
+		m_totals[c] += val;
 	}
 #endif
 }
 
+double GSPerfMon::GetFrameTime(int percentile)
+{
+	int count = std::min<int>(m_frametime_count, FrameTimeCount);
+
+	if(count == 0)
+	{
+		return 0;
+	}
+
+	float frametimes[FrameTimeCount];
+
+	memcpy(frametimes, m_frametimes, sizeof(float) * count);
+
+	int n = std::min<int>(count * std::max<int>(percentile, 0) / 100, count - 1);
+
+	std::nth_element(frametimes, frametimes + n, frametimes + count);
+
+	return frametimes[n];
+}
+
 void GSPerfMon::Update()
 {
 #ifndef DISABLE_PERF_MON
@@ -84,11 +139,9 @@ void GSPerfMon::Update()
 void GSPerfMon::Start(int timer)
 {
 #ifndef DISABLE_PERF_MON
-	m_start[timer] = __rdtsc();
-
-	if(m_begin[timer] == 0)
+	if(timer < m_timer_count)
 	{
-		m_begin[timer] = m_start[timer];
+		m_timers[timer].start = __rdtsc();
 	}
 #endif
 }
@@ -96,23 +149,40 @@ void GSPerfMon::Start(int timer)
 void GSPerfMon::Stop(int timer)
 {
 #ifndef DISABLE_PERF_MON
-	if(m_start[timer] > 0)
+	if(timer < m_timer_count)
 	{
-		m_total[timer] += __rdtsc() - m_start[timer];
-		m_start[timer] = 0;
+		Timer& t = m_timers[timer];
+
+		if(t.start > 0)
+		{
+			t.total.store(t.total.load(std::memory_order_relaxed) + __rdtsc() - t.start, std::memory_order_relaxed);
+			t.start = 0;
+		}
 	}
 #endif
 }
 
+// Returns the share of time spent in the timer since the last reset, in percent. Only the
+// owner thread writes the timer, so this can run while it is being used.
 int GSPerfMon::CPU(int timer, bool reset)
 {
-	int percent = (int)(100 * m_total[timer] / (__rdtsc() - m_begin[timer]));
+	if(timer >= m_timer_count)
+	{
+		return 0;
+	}
+
+	Timer& t = m_timers[timer];
+
+	uint64 now = __rdtsc();
+	uint64 total = t.total.load(std::memory_order_relaxed);
+	uint64 elapsed = now - t.last_time;
+
+	int percent = elapsed > 0 ? (int)(100 * (total - t.last_total) / elapsed) : 0;
 
 	if(reset)
 	{
-		m_begin[timer] = 0;
-		m_start[timer] = 0;
-		m_total[timer] = 0;
+		t.last_total = total;
+		t.last_time = now;
 	}
 
 	return percent;
@@ -28,21 +28,39 @@ public:
 	{
 		Main, 
 		Sync, 
-		WorkerDraw0, WorkerDraw1, WorkerDraw2, WorkerDraw3, WorkerDraw4, WorkerDraw5, WorkerDraw6, WorkerDraw7, 
-		WorkerDraw8, WorkerDraw9, WorkerDraw10, WorkerDraw11, WorkerDraw12, WorkerDraw13, WorkerDraw14, WorkerDraw15, 
-		TimerLast,
+		Prepare, // vertex trace and conversion, on the gs thread
+		WorkerDraw, // WorkerDraw + i is the draw timer of rasterizer worker i, see SetWorkerCount
 	};
 	
 	enum counter_t 
 	{
 		Frame, Prim, Draw, Swizzle, Unswizzle, Fillrate, Quad, SyncPoint,
+		TexCacheHit, TexCacheMiss, TexCacheCollision,
+		// sw renderer syncs by reason, only counted when there was work to wait for
+		SyncReset, SyncVSync, SyncOutput, SyncDump, SyncSource, SyncTarget, SyncWrite, SyncRead, SyncPartial,
 		CounterLast,
 	};
 
 protected:
+	// Each timer is only started and stopped by one thread, the one it belongs to. They get
+	// a cache line each so the workers don't share lines, and CPU() only reads the total.
+
+	struct alignas(64) Timer
+	{
+		uint64 start;
+		std::atomic<uint64> total;
+		uint64 last_total, last_time; // used by CPU()
+	};
+
+	static const int FrameTimeCount = 256; // power of 2
+
 	double m_counters[CounterLast];
 	double m_stats[CounterLast];
-	uint64 m_begin[TimerLast], m_total[TimerLast], m_start[TimerLast];
+	double m_totals[CounterLast]; // since the start, not reset by Update
+	Timer* m_timers;
+	int m_timer_count;
+	float m_frametimes[FrameTimeCount];
+	int m_frametime_count;
 	uint64 m_frame;
 	clock_t m_lastframe;
 	int m_count;
@@ -51,12 +69,20 @@ protected:
 
 public:
 	GSPerfMon();
+	~GSPerfMon();
+
+	// must be called before the workers start
+	void SetWorkerCount(int count);
+	int GetWorkerCount() const {return m_timer_count - WorkerDraw;}
 
 	void SetFrame(uint64 frame) {m_frame = frame;}
 	uint64 GetFrame() {return m_frame;}
 
 	void Put(counter_t c, double val = 0);
 	double Get(counter_t c) {return m_stats[c];}
+	double GetTotal(counter_t c) {return m_totals[c];}
+	uint64 GetTicks(int timer) {return timer < m_timer_count ? m_timers[timer].total.load(std::memory_order_relaxed) : 0;}
+	double GetFrameTime(int percentile); // in ms, over the last FrameTimeCount frames
 	void Update();
 
 	void Start(int timer = Main);
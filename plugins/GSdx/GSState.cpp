@@ -1650,8 +1650,12 @@ void GSState::FlushPrim()
 
 		if(GSLocalMemory::m_psm[m_context->FRAME.PSM].fmt < 3 && GSLocalMemory::m_psm[m_context->ZBUF.PSM].fmt < 3)
 		{
+			m_perfmon.Start(GSPerfMon::Prepare);
+
 			m_vt.Update(m_vertex.buff, m_index.buff, m_vertex.tail, m_index.tail, GSUtil::GetPrimClass(PRIM->PRIM));
 
+			m_perfmon.Stop(GSPerfMon::Prepare);
+
 			m_context->SaveReg();
 
 			try {
@@ -332,6 +332,7 @@ void GSdxApp::Init()
 	m_default_configuration["autoflush_sw"]                               = "1";
 	m_default_configuration["capture_enabled"]                            = "0";
 	m_default_configuration["capture_out_dir"]                            = "/tmp/GSdx_Capture";
+	m_default_configuration["capture_stream"]                             = "0";
 	m_default_configuration["capture_threads"]                            = "4";
 	m_default_configuration["CaptureHeight"]                              = "480";
 	m_default_configuration["CaptureWidth"]                               = "640";
@@ -343,6 +344,7 @@ void GSdxApp::Init()
 	m_default_configuration["disable_hw_gl_draw"]                         = "0";
 	m_default_configuration["dithering_ps2"]                              = "1";
 	m_default_configuration["dump"]                                       = "0";
+	m_default_configuration["dump_keyframe_interval"]                     = "300";
 	m_default_configuration["extrathreads"]                               = "2";
 	m_default_configuration["extrathreads_height"]                        = "4";
 	m_default_configuration["filter"]                                     = std::to_string(static_cast<int8>(BiFiltering::PS2));
@@ -393,6 +395,8 @@ void GSdxApp::Init()
 	m_default_configuration["png_compression_level"]                      = std::to_string(Z_BEST_SPEED);
 	m_default_configuration["preload_frame_with_gs_data"]                 = "0";
 	m_default_configuration["Renderer"]                                   = std::to_string(static_cast<int>(GSRendererType::Default));
+	m_default_configuration["replay_end_frame"]                           = "0";
+	m_default_configuration["replay_start_frame"]                         = "0";
 	m_default_configuration["resx"]                                       = "1024";
 	m_default_configuration["resy"]                                       = "1024";
 	m_default_configuration["save"]                                       = "0";
@@ -373,6 +373,8 @@ void GSRenderer::VSync(int field)
 				m_perfmon.Get(GSPerfMon::Unswizzle) / 1024
 			);
 
+			s += format(" | %.2f/%.2f ms", m_perfmon.GetFrameTime(50), m_perfmon.GetFrameTime(99));
+
 			double fillrate = m_perfmon.Get(GSPerfMon::Fillrate);
 
 			if(fillrate > 0)
@@ -381,9 +383,9 @@ void GSRenderer::VSync(int field)
 
 				int sum = 0;
 
-				for(int i = 0; i < 16; i++)
+				for(int i = 0; i < m_perfmon.GetWorkerCount(); i++)
 				{
-					sum += m_perfmon.CPU(GSPerfMon::WorkerDraw0 + i);
+					sum += m_perfmon.CPU(GSPerfMon::WorkerDraw + i);
 				}
 
 				s += format(" | %d%% CPU", sum);
@@ -470,7 +472,20 @@ void GSRenderer::VSync(int field)
 	else if(m_dump)
 	{
 		if(m_dump->VSync(field, !m_control_key, m_regs))
+		{
 			m_dump.reset();
+		}
+		else if(m_dump->IsKeyFrameDue())
+		{
+			GSFreezeData fd = {0, nullptr};
+			Freeze(&fd, true);
+			fd.data = new uint8[fd.size];
+			Freeze(&fd, false);
+
+			m_dump->KeyFrame(fd, m_regs);
+
+			delete [] fd.data;
+		}
 	}
 
 	// capture
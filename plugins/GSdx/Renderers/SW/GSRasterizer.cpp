@@ -133,7 +133,7 @@ int GSRasterizer::GetPixels(bool reset)
 
 void GSRasterizer::Draw(GSRasterizerData* data)
 {
-	GSPerfMonAutoTimer pmat(m_perfmon, GSPerfMon::WorkerDraw0 + m_id);
+	GSPerfMonAutoTimer pmat(m_perfmon, GSPerfMon::WorkerDraw + m_id);
 
 	if(data->vertex != NULL && data->vertex_count == 0 || data->index != NULL && data->index_count == 0) return;
 
@@ -1189,6 +1189,55 @@ void GSRasterizerList::Sync()
 	}
 }
 
+bool GSRasterizerList::Sync(uint32 workers)
+{
+	bool synced = true;
+
+	for(size_t i = 0; i < m_workers.size(); i++)
+	{
+		// workers beyond the width of the mask are always waited for, see GetWorkers
+
+		if(i >= 32 || (workers & (1u << i)))
+		{
+			if(!m_workers[i]->IsEmpty())
+			{
+				m_workers[i]->Wait();
+
+				synced = false;
+			}
+		}
+	}
+
+	if(!synced)
+	{
+		m_perfmon->Put(GSPerfMon::SyncPoint, 1);
+	}
+
+	return !synced;
+}
+
+uint32 GSRasterizerList::GetWorkers(const GSRasterizerData* data) const
+{
+	if(m_workers.size() > 32)
+	{
+		return 0xffffffff;
+	}
+
+	GSVector4i r = data->bbox.rintersect(data->scissor);
+
+	int top = r.top >> m_thread_height;
+	int bottom = std::min<int>((r.bottom + (1 << m_thread_height) - 1) >> m_thread_height, top + m_workers.size());
+
+	uint32 workers = 0;
+
+	while(top < bottom)
+	{
+		workers |= 1u << m_scanline[top++];
+	}
+
+	return workers;
+}
+
 bool GSRasterizerList::IsSynced() const
 {
 	for(size_t i = 0; i < m_workers.size(); i++)
@@ -117,6 +117,8 @@ public:
 
 	virtual void Queue(const std::shared_ptr<GSRasterizerData>& data) = 0;
 	virtual void Sync() = 0;
+	virtual bool Sync(uint32 workers) = 0; // waits for the workers in the mask only, returns false if none of them had work
+	virtual uint32 GetWorkers(const GSRasterizerData* data) const = 0; // mask of the workers Queue sends data to
 	virtual bool IsSynced() const = 0;
 	virtual int GetPixels(bool reset = true) = 0;
 	virtual void PrintStats() = 0;
@@ -173,6 +175,8 @@ public:
 
 	void Queue(const std::shared_ptr<GSRasterizerData>& data);
 	void Sync() {}
+	bool Sync(uint32 workers) {return false;}
+	uint32 GetWorkers(const GSRasterizerData* data) const {return 0;}
 	bool IsSynced() const {return true;}
 	int GetPixels(bool reset);
 	void PrintStats() {m_ds->PrintStats();}
@@ -199,6 +203,8 @@ public:
 	{
 		threads = std::max<int>(threads, 0);
 
+		perfmon->SetWorkerCount(std::max<int>(threads, 1)); // without workers the rasterizer runs inline, still timed as worker 0
+
 		if(threads == 0)
 		{
 			return new GSRasterizer(new DS(), 0, 1, perfmon);
@@ -221,6 +227,8 @@ public:
 
 	void Queue(const std::shared_ptr<GSRasterizerData>& data);
 	void Sync();
+	bool Sync(uint32 workers);
+	uint32 GetWorkers(const GSRasterizerData* data) const;
 	bool IsSynced() const;
 	int GetPixels(bool reset);
 	void PrintStats() {}
@@ -51,6 +51,8 @@ GSRendererSW::GSRendererSW(int threads)
 
 	m_rl = GSRasterizerList::Create<GSDrawScanline>(threads, &m_perfmon);
 
+	m_mem.SetHelperThreads(threads); // texture conversion and image transfers
+
 	m_output = (uint8*)_aligned_malloc(1024 * 1024 * sizeof(uint32), 32);
 
 	for (uint32 i = 0; i < countof(m_fzb_pages); i++) {
@@ -60,6 +62,8 @@ GSRendererSW::GSRendererSW(int threads)
 		m_tex_pages[i] = 0;
 	}
 
+	memset(m_page_workers, 0, sizeof(m_page_workers));
+
 	#define InitCVB2(P, Q) \
 		m_cvb[P][0][0][Q] = &GSRendererSW::ConvertVertexBuffer<P, 0, 0, Q>; \
 		m_cvb[P][0][1][Q] = &GSRendererSW::ConvertVertexBuffer<P, 0, 1, Q>; \
@@ -87,6 +91,8 @@ GSRendererSW::GSRendererSW(int threads)
 
 GSRendererSW::~GSRendererSW()
 {
+	m_batch.reset(); // releases texture pages
+
 	delete m_tc;
 
 	for(size_t i = 0; i < countof(m_texture); i++)
@@ -103,6 +109,8 @@ void GSRendererSW::Reset()
 {
 	Sync(-1);
 
+	m_heap.Reset();
+
 	m_tc->RemoveAll();
 
 	GSRenderer::Reset();
@@ -112,6 +120,8 @@ void GSRendererSW::VSync(int field)
 {
 	Sync(0); // IncAge might delete a cached texture in use
 
+	m_heap.Reset();
+
 	if(0) if(LOG)
 	{
 		fprintf(s_fp, "%llu\n", m_perfmon.GetFrame());
@@ -133,7 +143,7 @@ void GSRendererSW::VSync(int field)
 
 	for(size_t i = 0; i < countof(draw); i++)
 	{
-		draw[i] = m_perfmon.CPU(GSPerfMon::WorkerDraw0 + i);
+		draw[i] = m_perfmon.CPU(GSPerfMon::WorkerDraw + i);
 		sum += draw[i];
 	}
 
@@ -214,26 +224,37 @@ GSTexture* GSRendererSW::GetFeedbackOutput()
 template<uint32 primclass, uint32 tme, uint32 fst, uint32 q_div>
 void GSRendererSW::ConvertVertexBuffer(GSVertexSW* RESTRICT dst, const GSVertex* RESTRICT src, size_t count)
 {
-	// FIXME q_div wasn't added to AVX2 code path.
+	GSVector4i off = (GSVector4i)m_context->XYOFFSET;
+	GSVector4 tsize = GSVector4(0x10000 << m_context->TEX0.TW, 0x10000 << m_context->TEX0.TH, 1, 0);
+
+	#if _M_SSE >= 0x401
+
+	GSVector4i z_max = GSVector4i::xffffffff().srl32(GSLocalMemory::m_psm[m_context->ZBUF.PSM].fmt * 8);
+
+	#else
 
-	#if 0//_M_SSE >= 0x501
+	uint32_t z_max = 0xffffffff >> (GSLocalMemory::m_psm[m_context->ZBUF.PSM].fmt * 8);
 
-	// TODO: something isn't right here, this makes other functions slower (split load/store? old sse code in 3rd party lib?)
+	#endif
 
-	GSVector8i o2((GSVector4i)m_context->XYOFFSET);
-	GSVector8 tsize2(GSVector4(0x10000 << m_context->TEX0.TW, 0x10000 << m_context->TEX0.TH, 1, 0));
+	int i = (int)m_vertex.next;
 
-	for(int i = (int)m_vertex.next; i > 0; i -= 2, src += 2, dst += 2) // ok to overflow, allocator makes sure there is one more dummy vertex
+	#if _M_SSE >= 0x501
+
+	// two vertices per iteration, one in each 128-bit lane, the odd one out is left to the loop below
+
+	GSVector8i o2(off);
+	GSVector8 tsize2(tsize);
+	GSVector8i z_max2(z_max);
+
+	for(; i >= 2; i -= 2, src += 2, dst += 2)
 	{
 		GSVector8i v0 = GSVector8i::load<true>(src[0].m);
 		GSVector8i v1 = GSVector8i::load<true>(src[1].m);
 
-		GSVector8 stcq = GSVector8::cast(v0.ac(v1));
+		GSVector8 stcq = GSVector8::cast(v0.ac(v1)); // s t rgba q
 		GSVector8i xyzuvf = v0.bd(v1);
 
-		//GSVector8 stcq = GSVector8::load(&src[0].m[0], &src[1].m[0]);
-		//GSVector8i xyzuvf = GSVector8i::load(&src[0].m[1], &src[1].m[1]);
-
 		GSVector8i xy = xyzuvf.upl16() - o2;
 		GSVector8i zf = xyzuvf.ywww().min_u32(GSVector8i::xffffff00());
 
@@ -248,6 +269,14 @@ void GSRendererSW::ConvertVertexBuffer(GSVertexSW* RESTRICT dst, const GSVertex*
 			{
 				t = GSVector8(xyzuvf.uph16() << (16 - 4));
 			}
+			else if(q_div)
+			{
+				// q(n) isn't valid for sprites, both use q(n+1) from the high lane
+
+				GSVector8 q = primclass == GS_SPRITE_CLASS ? stcq.bb() : stcq;
+
+				t = (stcq / q.wwww()) * tsize2;
+			}
 			else
 			{
 				t = stcq.xyww() * tsize2;
@@ -256,48 +285,19 @@ void GSRendererSW::ConvertVertexBuffer(GSVertexSW* RESTRICT dst, const GSVertex*
 
 		if(primclass == GS_SPRITE_CLASS)
 		{
+			xyzuvf = xyzuvf.min_u32(z_max2);
 			t = t.insert32<1, 3>(GSVector8::cast(xyzuvf));
 		}
 
 		GSVector8::storel(&dst[0].p, p);
-
-		if(tme || primclass == GS_SPRITE_CLASS)
-		{
-			GSVector8::store<true>(&dst[0].t, t.ac(c));
-		}
-		else
-		{
-			GSVector8::storel(&dst[0].c, c);
-		}
-
+		GSVector8::store<true>(&dst[0].t, t.ac(c));
 		GSVector8::storeh(&dst[1].p, p);
-
-		if(tme || primclass == GS_SPRITE_CLASS)
-		{
-			GSVector8::store<true>(&dst[1].t, t.bd(c));
-		}
-		else
-		{
-			GSVector8::storeh(&dst[1].c, c);
-		}
+		GSVector8::store<true>(&dst[1].t, t.bd(c));
 	}
 
-	#else
-	
-	GSVector4i off = (GSVector4i)m_context->XYOFFSET;
-	GSVector4 tsize = GSVector4(0x10000 << m_context->TEX0.TW, 0x10000 << m_context->TEX0.TH, 1, 0);
-
-	#if _M_SSE >= 0x401
-
-	GSVector4i z_max = GSVector4i::xffffffff().srl32(GSLocalMemory::m_psm[m_context->ZBUF.PSM].fmt * 8);
-
-	#else
-
-	uint32_t z_max = 0xffffffff >> (GSLocalMemory::m_psm[m_context->ZBUF.PSM].fmt * 8);
-
 	#endif
 
-	for(int i = (int)m_vertex.next; i > 0; i--, src++, dst++)
+	for(; i > 0; i--, src++, dst++)
 	{
 		GSVector4 stcq = GSVector4::load<true>(&src->m[0]); // s t rgba q
 
@@ -373,39 +373,59 @@ void GSRendererSW::ConvertVertexBuffer(GSVertexSW* RESTRICT dst, const GSVertex*
 		}
 
 		dst->t = t;
-
-		#if 0 //_M_SSE >= 0x501
-
-		dst->_pad = GSVector4::zero();
-
-		#endif
 	}
-
-	#endif
 }
 
 void GSRendererSW::Draw()
 {
 	const GSDrawingContext* context = m_context;
 
-	SharedData* sd = new SharedData(this);
+	SharedData* sd;
+
+	std::shared_ptr<GSRasterizerData> data;
+
+	size_t size = sizeof(GSVertexSW) * ((m_vertex.next + 1) & ~1) + sizeof(uint32) * m_index.tail;
+
+	uint8* buff;
+
+	if(!m_heap.IsFull())
+	{
+		sd = ::new (m_heap.Alloc(sizeof(SharedData))) SharedData(this, &m_heap);
+
+		data = std::shared_ptr<GSRasterizerData>(sd, FrameHeap::Deleter(), FrameHeap::Allocator<GSRasterizerData>(&m_heap));
+
+		buff = (uint8*)m_heap.Alloc(size);
+	}
+	else
+	{
+		// too much queued up for a single frame, fall back to the general heap
+
+		sd = new SharedData(this);
 
-	std::shared_ptr<GSRasterizerData> data(sd);
+		data = std::shared_ptr<GSRasterizerData>(sd);
+
+		buff = sd->buff = (uint8*)_aligned_malloc(size, 64);
+	}
 
 	sd->primclass = m_vt.m_primclass;
-	sd->buff = (uint8*)_aligned_malloc(sizeof(GSVertexSW) * ((m_vertex.next + 1) & ~1) + sizeof(uint32) * m_index.tail, 64);
-	sd->vertex = (GSVertexSW*)sd->buff;
+	sd->vertex = (GSVertexSW*)buff;
 	sd->vertex_count = m_vertex.next;
-	sd->index = (uint32*)(sd->buff + sizeof(GSVertexSW) * ((m_vertex.next + 1) & ~1));
+	sd->index = (uint32*)(buff + sizeof(GSVertexSW) * ((m_vertex.next + 1) & ~1));
 	sd->index_count = m_index.tail;
+	sd->m_vertex_capacity = (m_vertex.next + 1) & ~1;
+	sd->m_index_capacity = m_index.tail;
 
 	// skip per pixel division if q is constant.
 	// Optimize the division by 1 with a nop. It also means that GS_SPRITE_CLASS must be processed when !m_vt.m_eq.q.
 	// If you have both GS_SPRITE_CLASS && m_vt.m_eq.q, it will depends on the first part of the 'OR'
 	uint32 q_div = !IsMipMapActive() && ((m_vt.m_eq.q && m_vt.m_min.t.z != 1.0f) || (!m_vt.m_eq.q && m_vt.m_primclass == GS_SPRITE_CLASS));
 
+	m_perfmon.Start(GSPerfMon::Prepare);
+
 	(this->*m_cvb[m_vt.m_primclass][PRIM->TME][PRIM->FST][q_div])(sd->vertex, m_vertex.buff, m_vertex.next);
 
+	m_perfmon.Stop(GSPerfMon::Prepare);
+
 	memcpy(sd->index, m_index.buff, sizeof(uint32) * m_index.tail);
 
 	GSVector4i scissor = GSVector4i(context->scissor.in);
@@ -592,9 +612,16 @@ void GSRendererSW::Queue(std::shared_ptr<GSRasterizerData>& item)
 {
 	SharedData* sd = (SharedData*)item.get();
 
+	if(sd->m_syncpoint != SharedData::SyncNone)
+	{
+		FlushBatch(); // the page workers of the pending batch are only known after this
+	}
+
+	// only wait for the workers which may have queued draws sharing pages with this one
+
 	if(sd->m_syncpoint == SharedData::SyncSource) 
 	{
-		Sync(4);
+		Sync(4, GetPageWorkers(sd));
 	}
 
 	// update previously invalidated parts
@@ -603,7 +630,7 @@ void GSRendererSW::Queue(std::shared_ptr<GSRasterizerData>& item)
 
 	if(sd->m_syncpoint == SharedData::SyncTarget)
 	{
-		Sync(5);
+		Sync(5, GetPageWorkers(sd));
 	}
 
 	if(LOG)
@@ -620,7 +647,17 @@ void GSRendererSW::Queue(std::shared_ptr<GSRasterizerData>& item)
 		fflush(s_fp);
 	}
 
-	m_rl->Queue(item);
+	if(!MergeBatch(sd))
+	{
+		FlushBatch();
+
+		m_batch = item;
+	}
+
+	if(m_batch->index_count >= BatchMaxIndexCount)
+	{
+		FlushBatch();
+	}
 
 	// invalidate new parts rendered onto
 
@@ -637,15 +674,157 @@ void GSRendererSW::Queue(std::shared_ptr<GSRasterizerData>& item)
 	}
 }
 
-void GSRendererSW::Sync(int reason)
+bool GSRendererSW::MergeBatch(SharedData* sd)
+{
+	if(m_batch == NULL || sd->m_syncpoint != SharedData::SyncNone)
+	{
+		return false;
+	}
+
+	SharedData* batch = (SharedData*)m_batch.get();
+
+	if(batch->primclass != sd->primclass || !batch->scissor.eq(sd->scissor) || batch->index_count + sd->index_count > BatchMaxIndexCount)
+	{
+		return false;
+	}
+
+	// everything the workers read from the global data must match, clut and dimx are copies
+
+	const GSScanlineGlobalData& a = batch->global;
+	const GSScanlineGlobalData& b = sd->global;
+
+	if(a.sel.key != b.sel.key || a.vm != b.vm || memcmp(a.tex, b.tex, sizeof(a.tex)) != 0
+	|| a.fbr != b.fbr || a.zbr != b.zbr || a.fbc != b.fbc || a.zbc != b.zbc || a.fzbr != b.fzbr || a.fzbc != b.fzbc
+	|| memcmp(&a.aref, &b.aref, (const uint8*)(&a + 1) - (const uint8*)&a.aref) != 0)
+	{
+		return false;
+	}
+
+	if((a.clut == NULL) != (b.clut == NULL) || a.clut != NULL && memcmp(a.clut, b.clut, sizeof(uint32) * GSLocalMemory::m_psm[m_context->TEX0.PSM].pal) != 0)
+	{
+		return false;
+	}
+
+	if((a.dimx == NULL) != (b.dimx == NULL) || a.dimx != NULL && memcmp(a.dimx, b.dimx, sizeof(m_env.dimx)) != 0)
+	{
+		return false;
+	}
+
+	// append the vertices and indices, the buffer grows in powers of two
+
+	int vertex_count = batch->vertex_count + sd->vertex_count;
+	int index_count = batch->index_count + sd->index_count;
+
+	if(vertex_count > batch->m_vertex_capacity || index_count > batch->m_index_capacity)
+	{
+		int vertex_capacity = std::max<int>(batch->m_vertex_capacity, 64);
+		int index_capacity = std::max<int>(batch->m_index_capacity, 64);
+
+		while(vertex_capacity < vertex_count) vertex_capacity <<= 1;
+		while(index_capacity < index_count) index_capacity <<= 1;
+
+		uint8* buff = (uint8*)batch->Alloc(sizeof(GSVertexSW) * vertex_capacity + sizeof(uint32) * index_capacity);
+
+		GSVertexSW* vertex = (GSVertexSW*)buff;
+		uint32* index = (uint32*)(buff + sizeof(GSVertexSW) * vertex_capacity);
+
+		memcpy(vertex, batch->vertex, sizeof(GSVertexSW) * batch->vertex_count);
+		memcpy(index, batch->index, sizeof(uint32) * batch->index_count);
+
+		if(batch->buff != NULL) // the frame heap only gives back memory on vsync
+		{
+			_aligned_free(batch->buff);
+
+			batch->buff = buff;
+		}
+		batch->vertex = vertex;
+		batch->index = index;
+		batch->m_vertex_capacity = vertex_capacity;
+		batch->m_index_capacity = index_capacity;
+	}
+
+	memcpy(&batch->vertex[batch->vertex_count], sd->vertex, sizeof(GSVertexSW) * sd->vertex_count);
+
+	uint32* RESTRICT dst = &batch->index[batch->index_count];
+
+	for(int i = 0; i < sd->index_count; i++)
+	{
+		dst[i] = sd->index[i] + batch->vertex_count;
+	}
+
+	batch->vertex_count = vertex_count;
+	batch->index_count = index_count;
+
+	// the pages of the batch have to cover the new area too
+
+	GSVector4i r = batch->bbox.rintersect(batch->scissor);
+	GSVector4i r2 = r.runion(sd->bbox.rintersect(sd->scissor));
+
+	batch->bbox = batch->bbox.runion(sd->bbox);
+
+	if(!r2.eq(r))
+	{
+		int fpsm = batch->m_fpsm;
+		int zpsm = batch->m_zpsm;
+
+		batch->ReleasePages();
+		batch->UsePages(a.sel.fb ? m_context->offset.fb->GetPages(r2) : NULL, fpsm, a.sel.zb ? m_context->offset.zb->GetPages(r2) : NULL, zpsm);
+	}
+
+	return true;
+}
+
+void GSRendererSW::FlushBatch()
+{
+	if(m_batch != NULL)
+	{
+		m_rl->Queue(m_batch);
+
+		SetPageWorkers((SharedData*)m_batch.get(), m_rl->GetWorkers(m_batch.get()));
+
+		m_batch.reset();
+	}
+}
+
+void GSRendererSW::Sync(int reason, uint32 workers)
 {
 	//printf("sync %d\n", reason);
 
 	GSPerfMonAutoTimer pmat(&m_perfmon, GSPerfMon::Sync);
 
+	FlushBatch();
+
+	if(!m_rl->IsSynced())
+	{
+		static const GSPerfMon::counter_t counters[] =
+		{
+			GSPerfMon::SyncReset, GSPerfMon::SyncVSync, GSPerfMon::SyncOutput, GSPerfMon::SyncDump, GSPerfMon::SyncDump,
+			GSPerfMon::SyncSource, GSPerfMon::SyncTarget, GSPerfMon::SyncWrite, GSPerfMon::SyncRead,
+		};
+
+		m_perfmon.Put(counters[reason + 1], 1);
+	}
+
 	uint64 t = __rdtsc();
 
-	m_rl->Sync();
+	if(workers == 0xffffffff)
+	{
+		m_rl->Sync();
+
+		memset(m_page_workers, 0, sizeof(m_page_workers));
+	}
+	else
+	{
+		if(m_rl->Sync(workers))
+		{
+			m_perfmon.Put(GSPerfMon::SyncPartial, 1);
+		}
+
+		for(size_t i = 0; i < countof(m_page_workers); i++)
+		{
+			m_page_workers[i] &= ~workers;
+		}
+	}
 
 	if(0) if(LOG)
 	{
@@ -685,13 +864,15 @@ void GSRendererSW::InvalidateVideoMem(const GIFRegBITBLTBUF& BITBLTBUF, const GS
 
 	// check if the changing pages either used as a texture or a target
 
-	if(!m_rl->IsSynced())
+	if(!IsSynced())
 	{
 		for(uint32* RESTRICT p = m_tmp_pages; *p != GSOffset::EOP; p++)
 		{
 			if(m_fzb_pages[*p] | m_tex_pages[*p])
 			{
-				Sync(6);
+				FlushBatch();
+
+				Sync(6, GetPageWorkers(m_tmp_pages));
 
 				break;
 			}
@@ -705,7 +886,7 @@ void GSRendererSW::InvalidateLocalMem(const GIFRegBITBLTBUF& BITBLTBUF, const GS
 {
 	if(LOG) {fprintf(s_fp, "%s %05x %u %u, %d %d %d %d\n", clut ? "rp" : "r", BITBLTBUF.SBP, BITBLTBUF.SBW, BITBLTBUF.SPSM, r.x, r.y, r.z, r.w); fflush(s_fp);}
 
-	if(!m_rl->IsSynced())
+	if(!IsSynced())
 	{
 		GSOffset* off = m_mem.GetOffset(BITBLTBUF.SBP, BITBLTBUF.SBW, BITBLTBUF.SPSM);
 
@@ -715,7 +896,9 @@ void GSRendererSW::InvalidateLocalMem(const GIFRegBITBLTBUF& BITBLTBUF, const GS
 		{
 			if(m_fzb_pages[*p])
 			{
-				Sync(7);
+				FlushBatch();
+
+				Sync(7, GetPageWorkers(m_tmp_pages));
 
 				break;
 			}
@@ -765,9 +948,73 @@ void GSRendererSW::ReleasePages(const uint32* pages, const int type)
 	}
 }
 
+uint32 GSRendererSW::GetPageWorkers(const uint32* pages) const
+{
+	uint32 workers = 0;
+
+	for(const uint32* p = pages; *p != GSOffset::EOP; p++)
+	{
+		workers |= m_page_workers[*p];
+	}
+
+	return workers;
+}
+
+// The draw can only conflict with queued draws through pages they share, so it is enough to
+// wait for the workers that may still have one of them queued.
+
+uint32 GSRendererSW::GetPageWorkers(const SharedData* sd) const
+{
+	uint32 workers = 0;
+
+	if(sd->global.sel.fb && sd->m_fb_pages != NULL)
+	{
+		workers |= GetPageWorkers(sd->m_fb_pages);
+	}
+
+	if(sd->global.sel.zb && sd->m_zb_pages != NULL)
+	{
+		workers |= GetPageWorkers(sd->m_zb_pages);
+	}
+
+	for(size_t i = 0; sd->m_tex[i].t != NULL; i++)
+	{
+		workers |= GetPageWorkers(sd->m_tex[i].t->m_pages.n);
+	}
+
+	return workers;
+}
+
+void GSRendererSW::SetPageWorkers(const SharedData* sd, uint32 workers)
+{
+	if(sd->global.sel.fb && sd->m_fb_pages != NULL)
+	{
+		for(const uint32* p = sd->m_fb_pages; *p != GSOffset::EOP; p++)
+		{
+			m_page_workers[*p] |= workers;
+		}
+	}
+
+	if(sd->global.sel.zb && sd->m_zb_pages != NULL)
+	{
+		for(const uint32* p = sd->m_zb_pages; *p != GSOffset::EOP; p++)
+		{
+			m_page_workers[*p] |= workers;
+		}
+	}
+
+	for(size_t i = 0; sd->m_tex[i].t != NULL; i++)
+	{
+		for(const uint32* p = sd->m_tex[i].t->m_pages.n; *p != GSOffset::EOP; p++)
+		{
+			m_page_workers[*p] |= workers;
+		}
+	}
+}
+
 bool GSRendererSW::CheckTargetPages(const uint32* fb_pages, const uint32* zb_pages, const GSVector4i& r)
 {
-	bool synced = m_rl->IsSynced();
+	bool synced = IsSynced();
 
 	bool fb = fb_pages != NULL;
 	bool zb = zb_pages != NULL;
@@ -931,7 +1178,7 @@ bool GSRendererSW::CheckTargetPages(const uint32* fb_pages, const uint32* zb_pag
 
 bool GSRendererSW::CheckSourcePages(SharedData* sd)
 {
-	if(!m_rl->IsSynced())
+	if(!IsSynced())
 	{
 		for(size_t i = 0; sd->m_tex[i].t != NULL; i++)
 		{
@@ -1058,7 +1305,7 @@ bool GSRendererSW::GetScanlineGlobalData(SharedData* data)
 			{
 				gd.sel.tlu = 1;
 
-				gd.clut = (uint32*)_aligned_malloc(sizeof(uint32) * 256, 32); // FIXME: might address uninitialized data of the texture (0xCD) that is not in 0-15 range for 4-bpp formats
+				gd.clut = (uint32*)data->Alloc(sizeof(uint32) * 256); // FIXME: might address uninitialized data of the texture (0xCD) that is not in 0-15 range for 4-bpp formats
 
 				memcpy(gd.clut, (const uint32*)m_mem.m_clut, sizeof(uint32) * GSLocalMemory::m_psm[context->TEX0.PSM].pal);
 			}
@@ -1327,7 +1574,7 @@ bool GSRendererSW::GetScanlineGlobalData(SharedData* data)
 		{
 			gd.sel.dthe = 1;
 
-			gd.dimx = (GSVector4i*)_aligned_malloc(sizeof(env.dimx), 32);
+			gd.dimx = (GSVector4i*)data->Alloc(sizeof(env.dimx));
 
 			memcpy(gd.dimx, env.dimx, sizeof(env.dimx));
 		}
@@ -1424,17 +1671,22 @@ bool GSRendererSW::GetScanlineGlobalData(SharedData* data)
 	return true;
 }
 
-GSRendererSW::SharedData::SharedData(GSRendererSW* parent)
+GSRendererSW::SharedData::SharedData(GSRendererSW* parent, FrameHeap* heap)
 	: m_parent(parent)
+	, m_heap(heap)
 	, m_fb_pages(NULL)
 	, m_zb_pages(NULL)
 	, m_fpsm(0)
 	, m_zpsm(0)
 	, m_using_pages(false)
 	, m_syncpoint(SyncNone)
+	, m_vertex_capacity(0)
+	, m_index_capacity(0)
 {
 	m_tex[0].t = NULL;
 
+	memset(&global, 0, sizeof(global)); // compared as a whole when merging draws
+
 	global.sel.key = 0;
 
 	global.clut = NULL;
@@ -1445,8 +1697,8 @@ GSRendererSW::SharedData::~SharedData()
 {
 	ReleasePages();
 
-	if(global.clut) _aligned_free(global.clut);
-	if(global.dimx) _aligned_free(global.dimx);
+	if(global.clut) Free(global.clut);
+	if(global.dimx) Free(global.dimx);
 
 	if(LOG) {fprintf(s_fp, "[%d] done t=%lld p=%d | %d %d %d | %08x_%08x\n", 
 		counter, 
@@ -1459,6 +1711,16 @@ GSRendererSW::SharedData::~SharedData()
 
 //static TransactionScope::Lock s_lock;
 
+void* GSRendererSW::SharedData::Alloc(size_t size)
+{
+	return m_heap != NULL ? m_heap->Alloc(size) : _aligned_malloc(size, 64);
+}
+
+void GSRendererSW::SharedData::Free(void* p)
+{
+	if(m_heap == NULL) _aligned_free(p);
+}
+
 void GSRendererSW::SharedData::UsePages(const uint32* fb_pages, int fpsm, const uint32* zb_pages, int zpsm)
 {
 	if(m_using_pages) return;
@@ -1582,3 +1844,84 @@ void GSRendererSW::SharedData::UpdateSource()
 		}
 	}
 }
+
+// FrameHeap
+
+GSRendererSW::FrameHeap::FrameHeap()
+	: m_block(0)
+	, m_pos(0)
+	, m_used(0)
+{
+}
+
+GSRendererSW::FrameHeap::~FrameHeap()
+{
+	for(auto& b : m_blocks)
+	{
+		_aligned_free(b.buff);
+	}
+}
+
+void* GSRendererSW::FrameHeap::Alloc(size_t size)
+{
+	size = (size + 63) & ~63;
+
+	while(true)
+	{
+		if(m_block == m_blocks.size())
+		{
+			Block b;
+
+			b.size = std::max<size_t>(size, BlockSize);
+			b.buff = (uint8*)_aligned_malloc(b.size, 64);
+
+			m_blocks.push_back(b);
+		}
+
+		Block& b = m_blocks[m_block];
+
+		if(m_pos + size <= b.size)
+		{
+			void* p = b.buff + m_pos;
+
+			m_pos += size;
+			m_used += size;
+
+			return p;
+		}
+
+		if(m_pos == 0)
+		{
+			// a block left from a previous frame, too small for this
+
+			_aligned_free(b.buff);
+
+			b.size = std::max<size_t>(size, BlockSize);
+			b.buff = (uint8*)_aligned_malloc(b.size, 64);
+
+			continue;
+		}
+
+		m_block++;
+		m_pos = 0;
+	}
+}
+
+void GSRendererSW::FrameHeap::Reset()
+{
+	// keep as many blocks as this frame needed, the next one is probably similar
+
+	for(size_t i = m_block + 1; i < m_blocks.size(); i++)
+	{
+		_aligned_free(m_blocks[i].buff);
+	}
+
+	if(m_block + 1 < m_blocks.size())
+	{
+		m_blocks.resize(m_block + 1);
+	}
+
+	m_block = 0;
+	m_pos = 0;
+	m_used = 0;
+}
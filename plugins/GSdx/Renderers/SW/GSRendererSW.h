@@ -31,6 +31,51 @@ class GSRendererSW : public GSRenderer
 	static GSVector8 m_pos_scale2;
 #endif
 
+	// The draws of a frame and their vertex/index buffers are carved out of a few large blocks and
+	// recycled together on vsync, when the workers are idle and nothing refers to them anymore.
+
+	class FrameHeap
+	{
+		struct Block {uint8* buff; size_t size;};
+
+		std::vector<Block> m_blocks;
+		size_t m_block;
+		size_t m_pos;
+		size_t m_used;
+
+	public:
+		enum {BlockSize = 1 << 20, MaxSize = 64 << 20};
+
+		template<class T> struct Allocator
+		{
+			typedef T value_type;
+
+			FrameHeap* m_heap;
+
+			Allocator(FrameHeap* heap) : m_heap(heap) {}
+			template<class U> Allocator(const Allocator<U>& a) : m_heap(a.m_heap) {}
+
+			T* allocate(size_t n) {return (T*)m_heap->Alloc(sizeof(T) * n);}
+			void deallocate(T* p, size_t n) {}
+
+			template<class U> bool operator == (const Allocator<U>& a) const {return m_heap == a.m_heap;}
+			template<class U> bool operator != (const Allocator<U>& a) const {return m_heap != a.m_heap;}
+		};
+
+		struct Deleter
+		{
+			void operator()(GSRasterizerData* p) const {p->~GSRasterizerData();}
+		};
+
+		FrameHeap();
+		~FrameHeap();
+
+		void* Alloc(size_t size);
+		void Reset();
+
+		bool IsFull() const {return m_used >= MaxSize;}
+	};
+
 	class SharedData : public GSDrawScanline::SharedData
 	{
 		struct alignas(16) TextureLevel
@@ -41,6 +86,7 @@ class GSRendererSW : public GSRenderer
 
 	public:
 		GSRendererSW* m_parent;
+		FrameHeap* m_heap; // NULL if not allocated from the frame heap
 		const uint32* m_fb_pages;
 		const uint32* m_zb_pages;
 		int m_fpsm;
@@ -48,11 +94,16 @@ class GSRendererSW : public GSRenderer
 		bool m_using_pages;
 		TextureLevel m_tex[7 + 1]; // NULL terminated
 		enum {SyncNone, SyncSource, SyncTarget} m_syncpoint;
+		int m_vertex_capacity;
+		int m_index_capacity;
 
 	public:
-		SharedData(GSRendererSW* parent);
+		SharedData(GSRendererSW* parent, FrameHeap* heap = NULL);
 		virtual ~SharedData();
 
+		void* Alloc(size_t size);
+		void Free(void* p);
+
 		void UsePages(const uint32* fb_pages, int fpsm, const uint32* zb_pages, int zpsm);
 		void ReleasePages();
 
@@ -77,8 +128,19 @@ protected:
 	uint32 m_fzb_cur_pages[16];
 	std::atomic<uint32> m_fzb_pages[512]; // uint16 frame/zbuf pages interleaved
 	std::atomic<uint16> m_tex_pages[512];
+	uint32 m_page_workers[512]; // workers which may still have queued draws using the page
 	uint32 m_tmp_pages[512 + 1];
 
+	// Small draws with the same state are merged into one before they are sent to the workers. The
+	// pending batch has its pages marked as used like a queued draw, so anything that checks them
+	// sees it, it only has to be flushed before waiting for the workers.
+
+	enum {BatchMaxIndexCount = 1024};
+
+	std::shared_ptr<GSRasterizerData> m_batch;
+
+	FrameHeap m_heap;
+
 	void Reset();
 	void VSync(int field);
 	void ResetDevice();
@@ -87,13 +149,20 @@ protected:
 
 	void Draw();
 	void Queue(std::shared_ptr<GSRasterizerData>& item);
-	void Sync(int reason);
+	bool MergeBatch(SharedData* sd);
+	void FlushBatch();
+	bool IsSynced() const {return m_batch == NULL && m_rl->IsSynced();}
+	void Sync(int reason, uint32 workers = 0xffffffff);
 	void InvalidateVideoMem(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r);
 	void InvalidateLocalMem(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r, bool clut = false);
 
 	void UsePages(const uint32* pages, const int type);
 	void ReleasePages(const uint32* pages, const int type);
 
+	uint32 GetPageWorkers(const uint32* pages) const;
+	uint32 GetPageWorkers(const SharedData* sd) const;
+	void SetPageWorkers(const SharedData* sd, uint32 workers);
+
 	bool CheckTargetPages(const uint32* fb_pages, const uint32* zb_pages, const GSVector4i& r);
 	bool CheckSourcePages(SharedData* sd);
 
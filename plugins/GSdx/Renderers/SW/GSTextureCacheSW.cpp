@@ -32,42 +32,60 @@ GSTextureCacheSW::~GSTextureCacheSW()
 	RemoveAll();
 }
 
-GSTextureCacheSW::Texture* GSTextureCacheSW::Lookup(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, uint32 tw0)
+uint64 GSTextureCacheSW::GetKey(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA)
 {
-	const GSLocalMemory::psm_t& psm = GSLocalMemory::m_psm[TEX0.PSM];
+	// TBP0 TBW PSM TW TH TCC, plus TA0 AEM TA1 when they affect the converted texels
 
-	auto& m = m_map[TEX0.TBP0 >> 5];
+	uint64 key = (uint64)TEX0.u32[0] | ((uint64)(TEX0.u32[1] & 7) << 32);
+
+	const GSLocalMemory::psm_t& psm = GSLocalMemory::m_psm[TEX0.PSM];
 
-	for(auto i = m.begin(); i != m.end(); ++i)
+	if((psm.trbpp == 16 || psm.trbpp == 24) && TEX0.TCC)
 	{
-		Texture* t = *i;
+		key |= (uint64)(TEXA.TA0 | (TEXA.AEM << 8) | (TEXA.TA1 << 9)) << 35;
+	}
 
-		if(((TEX0.u32[0] ^ t->m_TEX0.u32[0]) | ((TEX0.u32[1] ^ t->m_TEX0.u32[1]) & 3)) != 0) // TBP0 TBW PSM TW TH
-		{
-			continue;
-		}
+	return key;
+}
 
-		if((psm.trbpp == 16 || psm.trbpp == 24) && TEX0.TCC && TEXA != t->m_TEXA)
-		{
-			continue;
-		}
+GSTextureCacheSW::Texture* GSTextureCacheSW::Lookup(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, uint32 tw0)
+{
+	uint64 key = GetKey(TEX0, TEXA);
+
+	std::vector<Texture*>& v = m_lookup[key];
+
+	for(auto i = v.begin(); i != v.end(); ++i)
+	{
+		Texture* t = *i;
 
 		if(tw0 != 0 && t->m_tw != tw0)
 		{
+			m_state->m_perfmon.Put(GSPerfMon::TexCacheCollision, 1);
+
 			continue;
 		}
 
 		// Lookup hit
-		m.MoveFront(i.Index());
+
+		m_state->m_perfmon.Put(GSPerfMon::TexCacheHit, 1);
+
+		std::rotate(v.begin(), i, i + 1);
 		t->m_age = 0;
 		return t;
 	}
 
 	// Lookup miss
-	Texture* t = new Texture(m_state, tw0, TEX0, TEXA);
+
+	m_state->m_perfmon.Put(GSPerfMon::TexCacheMiss, 1);
+
+	Texture* t = new Texture(this, tw0, TEX0, TEXA);
+
+	t->m_key = key;
 
 	m_textures.insert(t);
 
+	v.insert(v.begin(), t);
+
 	for(const uint32* p = t->m_pages.n; *p != GSOffset::EOP; p++)
 	{
 		const uint32 page = *p;
@@ -113,6 +131,8 @@ void GSTextureCacheSW::RemoveAll()
 
 	m_textures.clear();
 
+	m_lookup.clear();
+
 	for(auto& l : m_map)
 	{
 		l.clear();
@@ -135,6 +155,20 @@ void GSTextureCacheSW::IncAge()
 				m_map[page].EraseIndex(t->m_erase_it[page]);
 			}
 
+			auto j = m_lookup.find(t->m_key);
+
+			if(j != m_lookup.end())
+			{
+				std::vector<Texture*>& v = j->second;
+
+				v.erase(std::find(v.begin(), v.end(), t));
+
+				if(v.empty())
+				{
+					m_lookup.erase(j);
+				}
+			}
+
 			delete t;
 		}
 		else
@@ -144,10 +178,38 @@ void GSTextureCacheSW::IncAge()
 	}
 }
 
+void GSTextureCacheSW::Read(const Texture* t)
+{
+	// Small updates are not worth the wake-up latency of the helpers, which are shared with GSLocalMemory::WriteImage
+
+	GSLocalMemory& mem = m_state->m_mem;
+
+	int n = m_reads.size() >= 256 ? mem.GetHelperThreads() + 1 : 1;
+
+	struct ReadJob
+	{
+		const Texture* t;
+		const BlockRead* reads;
+	};
+
+	ReadJob job = {t, m_reads.data()};
+
+	mem.RunHelpers([](const void* param, int begin, int end)
+	{
+		const ReadJob& job = *(const ReadJob*)param;
+
+		job.t->Read(job.reads + begin, job.reads + end);
+	}, &job, (int)m_reads.size(), n);
+
+	m_reads.clear();
+}
+
 //
 
-GSTextureCacheSW::Texture::Texture(GSState* state, uint32 tw0, const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA)
-	: m_state(state)
+GSTextureCacheSW::Texture::Texture(GSTextureCacheSW* tc, uint32 tw0, const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA)
+	: m_tc(tc)
+	, m_state(tc->m_state)
+	, m_key(0)
 	, m_buff(NULL)
 	, m_tw(tw0)
 	, m_age(0)
@@ -226,17 +288,15 @@ bool GSTextureCacheSW::Texture::Update(const GSVector4i& rect)
 		}
 	}
 
-	GSLocalMemory& mem = m_state->m_mem;
-
 	const GSOffset* RESTRICT off = m_offset;
 
 	uint32 blocks = 0;
 
-	GSLocalMemory::readTextureBlock rtxbP = psm.rtxbP;
+	std::vector<BlockRead>& reads = m_tc->m_reads;
 
 	uint32 pitch = (1 << m_tw) << shift;
 
-	uint8* dst = (uint8*)m_buff + pitch * r.top;
+	uint32 dst = pitch * r.top;
 
 	int block_pitch = pitch * bs.y;
 
@@ -264,7 +324,7 @@ bool GSTextureCacheSW::Texture::Update(const GSVector4i& rect)
 				{
 					m_valid[row] |= col;
 
-					(mem.*rtxbP)(block, &dst[x << shift], pitch, m_TEXA);
+					reads.push_back({block, dst + (x << shift)});
 
 					blocks++;
 				}
@@ -288,7 +348,7 @@ bool GSTextureCacheSW::Texture::Update(const GSVector4i& rect)
 				{
 					m_valid[row] |= col;
 
-					(mem.*rtxbP)(block, &dst[x << shift], pitch, m_TEXA);
+					reads.push_back({block, dst + (x << shift)});
 
 					blocks++;
 				}
@@ -298,12 +358,30 @@ bool GSTextureCacheSW::Texture::Update(const GSVector4i& rect)
 
 	if(blocks > 0)
 	{
+		m_tc->Read(this);
+
 		m_state->m_perfmon.Put(GSPerfMon::Unswizzle, bs.x * bs.y * blocks << shift);
 	}
 
 	return true;
 }
 
+void GSTextureCacheSW::Texture::Read(const BlockRead* RESTRICT begin, const BlockRead* RESTRICT end) const
+{
+	const GSLocalMemory& mem = m_state->m_mem;
+
+	GSLocalMemory::readTextureBlock rtxbP = GSLocalMemory::m_psm[m_TEX0.PSM].rtxbP;
+
+	uint32 pitch = (1 << m_tw) << (GSLocalMemory::m_psm[m_TEX0.PSM].pal == 0 ? 2 : 0);
+
+	uint8* dst = (uint8*)m_buff;
+
+	for(const BlockRead* RESTRICT i = begin; i < end; i++)
+	{
+		(mem.*rtxbP)(i->block, &dst[i->offset], pitch, m_TEXA);
+	}
+}
+
 #include "GSTextureSW.h"
 
 bool GSTextureCacheSW::Texture::Save(const std::string& fn, bool dds) const
@@ -27,13 +27,23 @@
 class GSTextureCacheSW
 {
 public:
+	class Texture;
+
+	struct BlockRead
+	{
+		uint32 block;
+		uint32 offset; // into Texture::m_buff
+	};
+
 	class Texture
 	{
 	public:
+		GSTextureCacheSW* m_tc;
 		GSState* m_state;
 		GSOffset* m_offset;
 		GIFRegTEX0 m_TEX0;
 		GIFRegTEXA m_TEXA;
+		uint64 m_key;
 		void* m_buff;
 		uint32 m_tw;
 		uint32 m_age;
@@ -49,17 +59,22 @@ public:
 		// fast mode: each uint32 bits map to the 32 blocks of that page
 		// repeating mode: 1 bpp image of the texture tiles (8x8), also having 512 elements is just a coincidence (worst case: (1024*1024)/(8*8)/(sizeof(uint32)*8))
 
-		Texture(GSState* state, uint32 tw0, const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA);
+		Texture(GSTextureCacheSW* tc, uint32 tw0, const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA);
 		virtual ~Texture();
 
 		bool Update(const GSVector4i& r);
+		void Read(const BlockRead* RESTRICT begin, const BlockRead* RESTRICT end) const;
 		bool Save(const std::string& fn, bool dds = false) const;
 	};
 
 protected:
 	GSState* m_state;
+	std::vector<BlockRead> m_reads;
 	std::unordered_set<Texture*> m_textures;
 	std::array<FastList<Texture*>, MAX_PAGES> m_map;
+	std::unordered_map<uint64, std::vector<Texture*>> m_lookup; // key = GetKey(TEX0, TEXA), usually a single texture, more only when mipmaps request a different tw
+
+	static uint64 GetKey(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA);
 
 public:
 	GSTextureCacheSW(GSState* state);
@@ -71,4 +86,6 @@ public:
 
 	void RemoveAll();
 	void IncAge();
+
+	void Read(const Texture* t);
 };
@@ -561,11 +561,13 @@ void populate_record_table(GtkWidget* record_table)
 	GtkWidget* out_dir       = CreateFileChooser(GTK_FILE_CHOOSER_ACTION_SELECT_FOLDER, "Select a directory", "capture_out_dir");
 	GtkWidget* png_label     = left_label("PNG Compression Level:");
 	GtkWidget* png_level     = CreateSpinButton(1, 9, "png_compression_level");
+	GtkWidget* stream_check  = CreateCheckBox("Stream to a single Y4M file", "capture_stream");
 
 	InsertWidgetInTable(record_table , capture_check);
 	InsertWidgetInTable(record_table , resxy_label   , resx_spin      , resy_spin);
 	InsertWidgetInTable(record_table , threads_label , threads_spin);
 	InsertWidgetInTable(record_table , png_label     , png_level);
+	InsertWidgetInTable(record_table , stream_check);
 	InsertWidgetInTable(record_table , out_dir_label , out_dir);
 }
 
@@ -0,0 +1,40 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2020 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// The GSBlock swizzling kernels of one instruction set, the same sources are compiled
+// once per ISA into their own namespace (see gsblock_kernels.inl).
+
+struct GSBlockKernel
+{
+	const char* name;
+	void (*run)(uint8_t* dst, const uint8_t* src); // src and dst are GSBlockKernelBufferSize bytes
+};
+
+struct GSBlockKernels
+{
+	void (*init)();
+	const GSBlockKernel* kernel;
+	size_t count;
+};
+
+enum { GSBlockKernelBufferSize = 256 * 64 };
+
+extern const GSBlockKernels gsblock_kernels_sse4;
+extern const GSBlockKernels gsblock_kernels_avx2;
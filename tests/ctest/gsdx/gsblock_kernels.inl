@@ -0,0 +1,65 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2020 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Included by one source file per instruction set with GSBLOCK_ISA and GSBLOCK_KERNELS
+// defined. GSdx picks its vector code at compile time, so each build of the GSdx sources
+// is wrapped in a namespace to keep them apart in the same executable.
+
+#include "gsblock_kernels.h"
+#include "stdafx.h"
+
+namespace GSBLOCK_ISA
+{
+#include "GSVector.cpp"
+#include "GSTables.cpp"
+#include "GSBlock.cpp"
+
+	static void Init()
+	{
+		GSBlock::InitVectors();
+		GSVector4i::InitVectors();
+		GSVector4::InitVectors();
+#if _M_SSE >= 0x500
+		GSVector8::InitVectors();
+#endif
+#if _M_SSE >= 0x501
+		GSVector8i::InitVectors();
+#endif
+	}
+
+	static const int pitch = 256;
+
+	static const GSBlockKernel kernels[] =
+	{
+		{"WriteBlock32", [](uint8* dst, const uint8* src) {GSBlock::WriteBlock32<32, 0xffffffff>(dst, src, pitch);}},
+		{"WriteBlock16", [](uint8* dst, const uint8* src) {GSBlock::WriteBlock16<32>(dst, src, pitch);}},
+		{"WriteBlock8", [](uint8* dst, const uint8* src) {GSBlock::WriteBlock8<32>(dst, src, pitch);}},
+		{"WriteBlock8 (unaligned)", [](uint8* dst, const uint8* src) {GSBlock::WriteBlock8<0>(dst, src + 16, pitch);}},
+		{"WriteBlock4", [](uint8* dst, const uint8* src) {GSBlock::WriteBlock4<32>(dst, src, pitch);}},
+		{"WriteBlock4 (unaligned)", [](uint8* dst, const uint8* src) {GSBlock::WriteBlock4<0>(dst, src + 16, pitch);}},
+		{"ReadBlock32", [](uint8* dst, const uint8* src) {GSBlock::ReadBlock32(src, dst, pitch);}},
+		{"ReadBlock16", [](uint8* dst, const uint8* src) {GSBlock::ReadBlock16(src, dst, pitch);}},
+		{"ReadBlock8", [](uint8* dst, const uint8* src) {GSBlock::ReadBlock8(src, dst, pitch);}},
+		{"ReadBlock4", [](uint8* dst, const uint8* src) {GSBlock::ReadBlock4(src, dst, pitch);}},
+		{"ReadColumn8", [](uint8* dst, const uint8* src) {for(int y = 0; y < 8; y++) GSBlock::ReadColumn8(y, src, dst + y * 1024, pitch);}},
+		{"ReadColumn4", [](uint8* dst, const uint8* src) {for(int y = 0; y < 8; y++) GSBlock::ReadColumn4(y, src, dst + y * 1024, pitch);}},
+		{"WriteColumn4", [](uint8* dst, const uint8* src) {for(int y = 0; y < 8; y++) GSBlock::WriteColumn4<32>(y, dst, src + y * 1024, pitch);}},
+		{"ReadBlock4P", [](uint8* dst, const uint8* src) {GSBlock::ReadBlock4P(src, dst, pitch);}},
+		{"ReadAndExpandBlock8_32", [](uint8* dst, const uint8* src) {GSBlock::ReadAndExpandBlock8_32(src, dst, pitch, (const uint32*)(src + 8192));}},
+		{"ReadAndExpandBlock4_32", [](uint8* dst, const uint8* src) {GSBlock::ReadAndExpandBlock4_32(src, dst, pitch, (const uint64*)(src + 8192));}},
+	};
+}
+
+const GSBlockKernels GSBLOCK_KERNELS = {GSBLOCK_ISA::Init, GSBLOCK_ISA::kernels, sizeof(GSBLOCK_ISA::kernels) / sizeof(GSBLOCK_ISA::kernels[0])};
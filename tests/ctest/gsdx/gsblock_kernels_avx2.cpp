@@ -0,0 +1,25 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2020 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Built with -mavx2 and _M_SSE=0x501, see CMakeLists.txt
+
+#define GSBLOCK_ISA gsdx_avx2
+#define GSBLOCK_KERNELS gsblock_kernels_avx2
+
+#include "gsblock_kernels.inl"
+
+#if _M_SSE < 0x501
+#error The AVX2 kernels must be built with _M_SSE=0x501
+#endif
@@ -0,0 +1,118 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2020 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gsblock_kernels.h"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+// The SSE4.1 build of GSBlock is the reference, the AVX2 build must match it bit for bit.
+// Both are also timed, counting 256 bytes per kernel call.
+
+alignas(64) static uint8_t s_src[GSBlockKernelBufferSize];
+alignas(64) static uint8_t s_dst[2][GSBlockKernelBufferSize];
+
+static bool HasAVX2()
+{
+	return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2");
+}
+
+static void Seed(uint32_t seed)
+{
+	std::mt19937 rng(seed);
+
+	for (uint8_t& b : s_src)
+		b = static_cast<uint8_t>(rng());
+
+	memset(s_dst, 0xcd, sizeof(s_dst));
+}
+
+static double Throughput(const GSBlockKernel& k)
+{
+	const auto start = std::chrono::steady_clock::now();
+	const auto limit = std::chrono::milliseconds(20);
+
+	size_t calls = 0;
+	std::chrono::duration<double> elapsed;
+
+	do
+	{
+		for (int i = 0; i < 1000; i++)
+			k.run(s_dst[0], s_src);
+
+		calls += 1000;
+		elapsed = std::chrono::steady_clock::now() - start;
+	} while (elapsed < limit);
+
+	return calls * 256.0 / elapsed.count() / (1024 * 1024);
+}
+
+TEST(GSBlockTests, AVX2MatchesSSE4)
+{
+	if (!HasAVX2())
+	{
+		printf("AVX2 is not supported by this cpu, skipped\n");
+		return;
+	}
+
+	gsblock_kernels_sse4.init();
+	gsblock_kernels_avx2.init();
+
+	ASSERT_EQ(gsblock_kernels_sse4.count, gsblock_kernels_avx2.count);
+
+	for (size_t i = 0; i < gsblock_kernels_sse4.count; i++)
+	{
+		const GSBlockKernel& ref = gsblock_kernels_sse4.kernel[i];
+		const GSBlockKernel& avx2 = gsblock_kernels_avx2.kernel[i];
+
+		ASSERT_STREQ(ref.name, avx2.name);
+
+		for (uint32_t seed = 0; seed < 16; seed++)
+		{
+			Seed(seed);
+
+			ref.run(s_dst[0], s_src);
+			avx2.run(s_dst[1], s_src);
+
+			EXPECT_EQ(memcmp(s_dst[0], s_dst[1], GSBlockKernelBufferSize), 0) << ref.name << ", seed " << seed;
+		}
+	}
+}
+
+TEST(GSBlockTests, Throughput)
+{
+	const bool avx2 = HasAVX2();
+
+	gsblock_kernels_sse4.init();
+
+	if (avx2)
+		gsblock_kernels_avx2.init();
+
+	Seed(0);
+
+	printf("%-24s %10s %10s\n", "", "SSE4.1", "AVX2");
+
+	for (size_t i = 0; i < gsblock_kernels_sse4.count; i++)
+	{
+		printf("%-24s %10.0f", gsblock_kernels_sse4.kernel[i].name, Throughput(gsblock_kernels_sse4.kernel[i]));
+
+		if (avx2)
+			printf(" %10.0f", Throughput(gsblock_kernels_avx2.kernel[i]));
+
+		printf(" MB/s\n");
+	}
+}